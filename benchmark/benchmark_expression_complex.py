@@ -48,6 +48,22 @@ def pybfoam_expression(n_elements):
     return run
 
 
+def pybfoam_lazy_expression(n_elements):
+    a = scalarField([1.1] * n_elements)
+    b = scalarField([2.2] * n_elements)
+    c = scalarField([3.3] * n_elements)
+    d = scalarField([4.4] * n_elements)
+    result = scalarField([0.0] * n_elements)
+
+    def run():
+        x = a.expr() * b + c
+        y = d - a.expr() * c
+        result.assign((x * y + b) / (a.expr() + 1.0))
+        return result
+
+    return run
+
+
 def numpy_expression(n_elements):
     a = np.full(n_elements, 1.1)
     b = np.full(n_elements, 2.2)
@@ -101,6 +117,10 @@ for n_elements in [10, 100, 1000, 10_000, 100_000, 1_000_000, 10_000_000]:
     # duration = t1 - t0
     add_data(n_elements, duration / n_repeat, "pybFoam")
 
+    bench = pybfoam_lazy_expression(n_elements)
+    duration = timeit.timeit(bench, number=n_repeat)
+    add_data(n_elements, duration / n_repeat, "pybFoam (lazy)")
+
     bench = numpy_expression(n_elements)
     duration = timeit.timeit(bench, number=n_repeat)
     # t0 = time.perf_counter() # lower overhead than timeit
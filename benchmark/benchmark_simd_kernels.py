@@ -0,0 +1,138 @@
+"""Compare the SIMD vector/tensor field kernels with the scalar path and NumPy.
+
+The scalar rows run the same kernels with ``pybFoam.set_simd_isa("scalar")``,
+i.e. the plain loops over OpenFOAM's array-of-structures storage.
+
+Usage: python benchmark_simd_kernels.py [case]
+
+With a case directory the volume field functions (mag, symm, dev2, ...) are
+timed on its mesh as well.
+"""
+
+import os
+import sys
+import time
+
+import numpy as np
+import pandas as pd
+
+import pybFoam
+from pybFoam import fvc, scalarField, vector, vectorField
+
+pybFoam.set_num_threads(1)
+pybFoam.set_simd_isa("avx512")  # limited to what the CPU supports
+detected = pybFoam.simd_isa()
+results_dir = os.path.abspath("results")
+
+ISAS = ["scalar", "avx2", "avx512"]
+REPEAT = 5
+
+
+def best_of(func, repeat=REPEAT):
+    func()  # warm up
+    durations = []
+    for _ in range(repeat):
+        t0 = time.perf_counter()
+        func()
+        durations.append(time.perf_counter() - t0)
+    return min(durations)
+
+
+data = {"kernel": [], "n_elements": [], "method": [], "duration": []}
+
+
+def add_data(kernel, n_elements, method, duration):
+    data["kernel"].append(kernel)
+    data["n_elements"].append(n_elements)
+    data["method"].append(method)
+    data["duration"].append(duration)
+
+
+def run(kernel, n_elements, pybfoam_func, numpy_func):
+    for isa in ISAS:
+        if ISAS.index(isa) > ISAS.index(detected):
+            continue
+        pybFoam.set_simd_isa(isa)
+        add_data(kernel, n_elements, f"pybFoam {isa}", best_of(pybfoam_func))
+    add_data(kernel, n_elements, "NumPy", best_of(numpy_func))
+
+
+# Field kernels
+for n_elements in [1000, 100_000, 1_000_000, 10_000_000]:
+    rng = np.random.default_rng(0)
+    a_np = rng.random((n_elements, 3))
+    b_np = rng.random((n_elements, 3))
+    s_np = rng.random(n_elements) + 0.5
+    a = vectorField(a_np)
+    b = vectorField(b_np)
+    s = scalarField(s_np)
+    u = vector(1, 2, 3)
+    u_np = np.array([1.0, 2.0, 3.0])
+
+    run("a & b", n_elements, lambda: a & b, lambda: np.einsum("ij,ij->i", a_np, b_np))
+    run("a & u", n_elements, lambda: a & u, lambda: a_np @ u_np)
+    run("a * s", n_elements, lambda: a * s, lambda: a_np * s_np[:, None])
+    run("a / s", n_elements, lambda: a / s, lambda: a_np / s_np[:, None])
+
+
+# Volume field functions
+if len(sys.argv) > 1:
+    os.chdir(sys.argv[1])
+    runTime = pybFoam.Time(".", ".")
+    mesh = pybFoam.fvMesh(runTime)
+
+    C = mesh.C()
+    C_np = np.asarray(C["internalField"])
+    n_elements = len(C_np)
+
+    T = fvc.grad(C)()
+    T_np = np.random.default_rng(1).random((n_elements, 9))
+    np.asarray(T["internalField"])[:] = T_np
+    S = pybFoam.symm(T)()
+    t_np = T_np.reshape(-1, 3, 3)
+    st_np = 0.5 * (t_np + t_np.transpose(0, 2, 1))
+    identity = np.eye(3)
+
+    run("mag(vector)", n_elements, lambda: pybFoam.mag(C), lambda: np.linalg.norm(C_np, axis=1))
+    run("magSqr(vector)", n_elements, lambda: pybFoam.magSqr(C), lambda: np.sum(C_np**2, axis=1))
+    run("mag(tensor)", n_elements, lambda: pybFoam.mag(T), lambda: np.linalg.norm(T_np, axis=1))
+    run(
+        "symm(tensor)",
+        n_elements,
+        lambda: pybFoam.symm(T),
+        lambda: 0.5 * (t_np + t_np.transpose(0, 2, 1)),
+    )
+    run(
+        "dev2(tensor)",
+        n_elements,
+        lambda: pybFoam.dev2(T),
+        lambda: t_np - (2.0 / 3.0) * np.trace(t_np, axis1=1, axis2=2)[:, None, None] * identity,
+    )
+    run(
+        "doubleInner",
+        n_elements,
+        lambda: pybFoam.doubleInner(T, S),
+        lambda: np.einsum("ijk,ijk->i", t_np, st_np),
+    )
+
+
+df = pd.DataFrame(data)
+df["time_per_element [ns]"] = df["duration"] / df["n_elements"] * 1e9
+print("SIMD kernel benchmark:\n", df)
+
+os.makedirs(results_dir, exist_ok=True)
+df.to_csv(os.path.join(results_dir, "benchmark_simd_kernels.csv"), index=False)
+print("\nResults saved to: results/benchmark_simd_kernels.csv")
+
+pivot_df = df.pivot_table(
+    index=["kernel", "n_elements"], columns="method", values="time_per_element [ns]"
+).round(2)
+
+with open(os.path.join(results_dir, "benchmark_simd_kernels.md"), "w") as f:
+    f.write("# SIMD Vector/Tensor Kernel Benchmark\n\n")
+    f.write(f"Detected instruction set: `{detected}`\n\n")
+    f.write("## Results (time per element in nanoseconds, single thread)\n\n")
+    f.write(pivot_df.to_markdown())
+    f.write("\n")
+
+print("Results table saved to: results/benchmark_simd_kernels.md")
@@ -18,8 +18,11 @@ from pybFoam.pybFoam_core import (
     argList,
     boolList,
     bound,
+    cellZoneAverage,
+    cellZoneIntegrate,
     computeCFLNumber,
     computeContinuityErrors,
+    computeFluxStatistics,
     constrainHbyA,
     constrainPressure,
     createMesh,
@@ -49,11 +52,13 @@ from pybFoam.pybFoam_core import (
     dimTime,
     dimVelocity,
     dimViscosity,
+    domainIntegrate,
     doubleInner,
     dynamicFvMesh,
     entry,
     fileName,
     fvMesh,
+    fvMeshSubset,
     fvScalarMatrix,
     fvSymmTensorMatrix,
     fvTensorMatrix,
@@ -68,6 +73,9 @@ from pybFoam.pybFoam_core import (
     min,
     nearWallDist,
     nearWallDistNoSearch,
+    patchAverage,
+    patchIntegrals,
+    patchIntegrate,
     pimpleControl,
     pisoControl,
     polyBoundaryMesh,
@@ -76,12 +84,18 @@ from pybFoam.pybFoam_core import (
     pow,
     pow3,
     pow6,
+    pythonSolverSystem,
+    register_linear_solver,
     scalarField,
+    scalarFieldExpr,
     selectTimes,
+    set_simd_isa,
     setRefCell,
+    simd_isa,
     simpleControl,
     skew,
     solve,
+    solve_all,
     sqr,
     sqrt,
     sum,
@@ -112,20 +126,52 @@ from pybFoam.pybFoam_core import (
     tmp_volVectorField,
     uniformDimensionedScalarField,
     uniformDimensionedVectorField,
+    unregister_linear_solver,
     vector,
     vectorField,
+    vectorFieldExpr,
     volScalarField,
     volSymmTensorField,
     volTensorField,
     volVectorField,
     wallDist,
+    weightedAverage,
     wordList,
     write,
 )
 
-from . import fvc, fvm, meshing, runTimeTables, sampling_bindings, thermo, turbulence
+from . import (
+    fvc,
+    fvm,
+    meshing,
+    pybFoam_core,
+    runTimeTables,
+    sampling_bindings,
+    telemetry,
+    thermo,
+    turbulence,
+)
 from ._version import __version__
 
+# Compiled modules with multithreaded kernels; each has its own thread pool
+_threaded_modules = [pybFoam_core, fvc, sampling_bindings]
+
+
+def set_num_threads(n: int) -> None:
+    """Set the number of threads used by the multithreaded field kernels.
+
+    ``n < 1`` selects all available cores. The default is a single thread.
+    The kernels release the GIL, so other Python threads can run meanwhile.
+    """
+    for module in _threaded_modules:
+        module.set_num_threads(n)
+
+
+def get_num_threads() -> int:
+    """Return the number of threads used by the multithreaded field kernels."""
+    return pybFoam_core.get_num_threads()
+
+
 __all__ = [
     # Core dictionary and info types
     "DictionaryGetOrDefaultProxy",
@@ -146,6 +192,7 @@ __all__ = [
     # Mesh types
     "dynamicFvMesh",
     "fvMesh",
+    "fvMeshSubset",
     "polyBoundaryMesh",
     "polyMesh",
     "polyPatch",
@@ -168,9 +215,11 @@ __all__ = [
     "vector",
     # Field types
     "scalarField",
+    "scalarFieldExpr",
     "symmTensorField",
     "tensorField",
     "vectorField",
+    "vectorFieldExpr",
     # Volume field types
     "volScalarField",
     "volSymmTensorField",
@@ -206,6 +255,10 @@ __all__ = [
     "tmp_fvSymmTensorMatrix",
     "tmp_fvTensorMatrix",
     "tmp_fvVectorMatrix",
+    # Python linear solvers
+    "pythonSolverSystem",
+    "register_linear_solver",
+    "unregister_linear_solver",
     # Dimensioned types
     "dimensionedScalar",
     "dimensionedSymmTensor",
@@ -239,6 +292,7 @@ __all__ = [
     "bound",
     "computeCFLNumber",
     "computeContinuityErrors",
+    "computeFluxStatistics",
     "constrainHbyA",
     "constrainPressure",
     "createMesh",
@@ -249,9 +303,18 @@ __all__ = [
     "selectTimes",
     "setRefCell",
     "solve",
+    "solve_all",
     "sum",
     "wallDist",
     "write",
+    # Field integrals
+    "cellZoneAverage",
+    "cellZoneIntegrate",
+    "domainIntegrate",
+    "patchAverage",
+    "patchIntegrals",
+    "patchIntegrate",
+    "weightedAverage",
     # Math operations
     "T",
     "dev2",
@@ -267,12 +330,18 @@ __all__ = [
     "sqr",
     "sqrt",
     "symm",
+    # Threading and SIMD
+    "get_num_threads",
+    "set_num_threads",
+    "set_simd_isa",
+    "simd_isa",
     # Submodules
     "fvc",
     "fvm",
     "meshing",
     "runTimeTables",
     "sampling_bindings",
+    "telemetry",
     "thermo",
     "turbulence",
     # Version
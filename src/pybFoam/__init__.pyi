@@ -5,6 +5,7 @@ from . import (
     pybFoam_core as pybFoam_core,
     runTimeTables as runTimeTables,
     sampling_bindings as sampling_bindings,
+    telemetry as telemetry,
     thermo as thermo,
     turbulence as turbulence
 )
@@ -28,8 +29,11 @@ from .pybFoam_core import (
     argList as argList,
     boolList as boolList,
     bound as bound,
+    cellZoneAverage as cellZoneAverage,
+    cellZoneIntegrate as cellZoneIntegrate,
     computeCFLNumber as computeCFLNumber,
     computeContinuityErrors as computeContinuityErrors,
+    computeFluxStatistics as computeFluxStatistics,
     constrainHbyA as constrainHbyA,
     constrainPressure as constrainPressure,
     createMesh as createMesh,
@@ -42,11 +46,13 @@ from .pybFoam_core import (
     dimensionedSymmTensor as dimensionedSymmTensor,
     dimensionedTensor as dimensionedTensor,
     dimensionedVector as dimensionedVector,
+    domainIntegrate as domainIntegrate,
     doubleInner as doubleInner,
     dynamicFvMesh as dynamicFvMesh,
     entry as entry,
     fileName as fileName,
     fvMesh as fvMesh,
+    fvMeshSubset as fvMeshSubset,
     fvScalarMatrix as fvScalarMatrix,
     fvSymmTensorMatrix as fvSymmTensorMatrix,
     fvTensorMatrix as fvTensorMatrix,
@@ -61,6 +67,9 @@ from .pybFoam_core import (
     min as min,
     nearWallDist as nearWallDist,
     nearWallDistNoSearch as nearWallDistNoSearch,
+    patchAverage as patchAverage,
+    patchIntegrals as patchIntegrals,
+    patchIntegrate as patchIntegrate,
     pimpleControl as pimpleControl,
     pisoControl as pisoControl,
     polyBoundaryMesh as polyBoundaryMesh,
@@ -69,12 +78,18 @@ from .pybFoam_core import (
     pow as pow,
     pow3 as pow3,
     pow6 as pow6,
+    pythonSolverSystem as pythonSolverSystem,
+    register_linear_solver as register_linear_solver,
     scalarField as scalarField,
+    scalarFieldExpr as scalarFieldExpr,
     selectTimes as selectTimes,
+    set_simd_isa as set_simd_isa,
     setRefCell as setRefCell,
+    simd_isa as simd_isa,
     simpleControl as simpleControl,
     skew as skew,
     solve as solve,
+    solve_all as solve_all,
     sqr as sqr,
     sqrt as sqrt,
     sum as sum,
@@ -105,18 +120,32 @@ from .pybFoam_core import (
     tmp_volVectorField as tmp_volVectorField,
     uniformDimensionedScalarField as uniformDimensionedScalarField,
     uniformDimensionedVectorField as uniformDimensionedVectorField,
+    unregister_linear_solver as unregister_linear_solver,
     vector as vector,
     vectorField as vectorField,
+    vectorFieldExpr as vectorFieldExpr,
     volScalarField as volScalarField,
     volSymmTensorField as volSymmTensorField,
     volTensorField as volTensorField,
     volVectorField as volVectorField,
     wallDist as wallDist,
+    weightedAverage as weightedAverage,
     wordList as wordList,
     write as write
 )
 
 
+def set_num_threads(n: int) -> None:
+    """
+    Set the number of threads used by the multithreaded field kernels.
+
+    ``n < 1`` selects all available cores. The default is a single thread.
+    The kernels release the GIL, so other Python threads can run meanwhile.
+    """
+
+def get_num_threads() -> int:
+    """Return the number of threads used by the multithreaded field kernels."""
+
 dimAcceleration: pybFoam_core.dimensionSet = ...
 
 dimArea: pybFoam_core.dimensionSet = ...
@@ -151,4 +180,4 @@ dimVelocity: pybFoam_core.dimensionSet = ...
 
 dimViscosity: pybFoam_core.dimensionSet = ...
 
-__all__: list[str] = ['DictionaryGetOrDefaultProxy', 'DictionaryGetProxy', 'Info', 'IOobject', 'Pstream', 'Time', 'Word', 'argList', 'dictionary', 'entry', 'fileName', 'instant', 'instantList', 'keyType', 'dynamicFvMesh', 'fvMesh', 'polyBoundaryMesh', 'polyMesh', 'polyPatch', 'SolverScalarPerformance', 'SolverSymmTensorPerformance', 'SolverTensorPerformance', 'SolverVectorPerformance', 'SymmTensorInt', 'TensorInt', 'VectorInt', 'boolList', 'labelList', 'wordList', 'symmTensor', 'tensor', 'vector', 'scalarField', 'symmTensorField', 'tensorField', 'vectorField', 'volScalarField', 'volSymmTensorField', 'volTensorField', 'volVectorField', 'surfaceScalarField', 'surfaceSymmTensorField', 'surfaceTensorField', 'surfaceVectorField', 'uniformDimensionedScalarField', 'uniformDimensionedVectorField', 'tmp_scalarField', 'tmp_symmTensorField', 'tmp_tensorField', 'tmp_vectorField', 'tmp_volScalarField', 'tmp_volSymmTensorField', 'tmp_volTensorField', 'tmp_volVectorField', 'tmp_surfaceScalarField', 'tmp_surfaceSymmTensorField', 'tmp_surfaceTensorField', 'tmp_surfaceVectorField', 'fvScalarMatrix', 'fvSymmTensorMatrix', 'fvTensorMatrix', 'fvVectorMatrix', 'tmp_fvScalarMatrix', 'tmp_fvSymmTensorMatrix', 'tmp_fvTensorMatrix', 'tmp_fvVectorMatrix', 'dimensionedScalar', 'dimensionedSymmTensor', 'dimensionedTensor', 'dimensionedVector', 'dimensionSet', 'dimAcceleration', 'dimArea', 'dimCurrent', 'dimDensity', 'dimEnergy', 'dimForce', 'dimLength', 'dimless', 'dimLuminousIntensity', 'dimMass', 'dimMoles', 'dimPower', 'dimPressure', 'dimTemperature', 'dimTime', 'dimVelocity', 'dimViscosity', 'pimpleControl', 'pisoControl', 'simpleControl', 'adjustPhi', 'bound', 'computeCFLNumber', 'computeContinuityErrors', 'constrainHbyA', 'constrainPressure', 'createMesh', 'createPhi', 'mag', 'nearWallDist', 'nearWallDistNoSearch', 'selectTimes', 'setRefCell', 'solve', 'sum', 'wallDist', 'write', 'T', 'dev2', 'devTwoSymm', 'doubleInner', 'magSqr', 'max', 'min', 'pow', 'pow3', 'pow6', 'skew', 'sqr', 'sqrt', 'symm', 'fvc', 'fvm', 'meshing', 'runTimeTables', 'sampling_bindings', 'thermo', 'turbulence', '__version__']
+__all__: list[str] = ['DictionaryGetOrDefaultProxy', 'DictionaryGetProxy', 'Info', 'IOobject', 'Pstream', 'Time', 'Word', 'argList', 'dictionary', 'entry', 'fileName', 'instant', 'instantList', 'keyType', 'dynamicFvMesh', 'fvMesh', 'fvMeshSubset', 'polyBoundaryMesh', 'polyMesh', 'polyPatch', 'SolverScalarPerformance', 'SolverSymmTensorPerformance', 'SolverTensorPerformance', 'SolverVectorPerformance', 'SymmTensorInt', 'TensorInt', 'VectorInt', 'boolList', 'labelList', 'wordList', 'symmTensor', 'tensor', 'vector', 'scalarField', 'scalarFieldExpr', 'symmTensorField', 'tensorField', 'vectorField', 'vectorFieldExpr', 'volScalarField', 'volSymmTensorField', 'volTensorField', 'volVectorField', 'surfaceScalarField', 'surfaceSymmTensorField', 'surfaceTensorField', 'surfaceVectorField', 'uniformDimensionedScalarField', 'uniformDimensionedVectorField', 'tmp_scalarField', 'tmp_symmTensorField', 'tmp_tensorField', 'tmp_vectorField', 'tmp_volScalarField', 'tmp_volSymmTensorField', 'tmp_volTensorField', 'tmp_volVectorField', 'tmp_surfaceScalarField', 'tmp_surfaceSymmTensorField', 'tmp_surfaceTensorField', 'tmp_surfaceVectorField', 'fvScalarMatrix', 'fvSymmTensorMatrix', 'fvTensorMatrix', 'fvVectorMatrix', 'tmp_fvScalarMatrix', 'tmp_fvSymmTensorMatrix', 'tmp_fvTensorMatrix', 'tmp_fvVectorMatrix', 'pythonSolverSystem', 'register_linear_solver', 'unregister_linear_solver', 'dimensionedScalar', 'dimensionedSymmTensor', 'dimensionedTensor', 'dimensionedVector', 'dimensionSet', 'dimAcceleration', 'dimArea', 'dimCurrent', 'dimDensity', 'dimEnergy', 'dimForce', 'dimLength', 'dimless', 'dimLuminousIntensity', 'dimMass', 'dimMoles', 'dimPower', 'dimPressure', 'dimTemperature', 'dimTime', 'dimVelocity', 'dimViscosity', 'pimpleControl', 'pisoControl', 'simpleControl', 'adjustPhi', 'bound', 'computeCFLNumber', 'computeContinuityErrors', 'computeFluxStatistics', 'constrainHbyA', 'constrainPressure', 'createMesh', 'createPhi', 'mag', 'nearWallDist', 'nearWallDistNoSearch', 'selectTimes', 'setRefCell', 'solve', 'solve_all', 'sum', 'wallDist', 'write', 'cellZoneAverage', 'cellZoneIntegrate', 'domainIntegrate', 'patchAverage', 'patchIntegrals', 'patchIntegrate', 'weightedAverage', 'T', 'dev2', 'devTwoSymm', 'doubleInner', 'magSqr', 'max', 'min', 'pow', 'pow3', 'pow6', 'skew', 'sqr', 'sqrt', 'symm', 'get_num_threads', 'set_num_threads', 'set_simd_isa', 'simd_isa', 'fvc', 'fvm', 'meshing', 'runTimeTables', 'sampling_bindings', 'telemetry', 'thermo', 'turbulence', '__version__']
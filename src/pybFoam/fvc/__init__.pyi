@@ -1,6 +1,10 @@
 """finite volume calculus"""
 
-from typing import overload
+from collections.abc import Sequence
+from typing import Annotated, overload
+
+import numpy
+from numpy.typing import NDArray
 
 import pybFoam.pybFoam_core
 
@@ -281,6 +285,18 @@ def interpolate(arg: pybFoam.pybFoam_core.volSymmTensorField, /) -> pybFoam.pybF
 @overload
 def interpolate(arg: pybFoam.pybFoam_core.tmp_volSymmTensorField, /) -> pybFoam.pybFoam_core.tmp_surfaceSymmTensorField: ...
 
+@overload
+def surfaceSum(arg: pybFoam.pybFoam_core.surfaceScalarField, /) -> pybFoam.pybFoam_core.tmp_volScalarField: ...
+
+@overload
+def surfaceSum(arg: pybFoam.pybFoam_core.tmp_surfaceScalarField, /) -> pybFoam.pybFoam_core.tmp_volScalarField: ...
+
+@overload
+def surfaceSum(arg: pybFoam.pybFoam_core.surfaceVectorField, /) -> pybFoam.pybFoam_core.tmp_volVectorField: ...
+
+@overload
+def surfaceSum(arg: pybFoam.pybFoam_core.tmp_surfaceVectorField, /) -> pybFoam.pybFoam_core.tmp_volVectorField: ...
+
 @overload
 def flux(arg: pybFoam.pybFoam_core.volVectorField, /) -> pybFoam.pybFoam_core.tmp_surfaceScalarField: ...
 
@@ -318,3 +334,114 @@ def reconstruct(arg: pybFoam.pybFoam_core.surfaceVectorField, /) -> pybFoam.pybF
 def reconstruct(arg: pybFoam.pybFoam_core.tmp_surfaceVectorField, /) -> pybFoam.pybFoam_core.tmp_volTensorField: ...
 
 def ddtCorr(arg0: pybFoam.pybFoam_core.volVectorField, arg1: pybFoam.pybFoam_core.surfaceScalarField, /) -> pybFoam.pybFoam_core.tmp_surfaceScalarField: ...
+
+def enable_cache(on: bool = True) -> None:
+    """
+    Cache grad, interpolate and snGrad of volume fields on their mesh until
+    the field (event number), its fvSchemes entry, the time index or the
+    mesh changes. Disabling drops all entries
+    """
+
+def cache_enabled() -> bool: ...
+
+def clear_cache() -> None:
+    """Drop all entries and reset the statistics"""
+
+def cache_stats() -> dict[str, int]:
+    """Number of hits, misses and stored entries"""
+
+@overload
+def invalidate_cache(field: pybFoam.pybFoam_core.volScalarField) -> None:
+    """
+    Drop the cached results of field, needed after writing to it
+    through a NumPy view
+    """
+
+@overload
+def invalidate_cache(field: pybFoam.pybFoam_core.volVectorField) -> None: ...
+
+@overload
+def invalidate_cache(field: pybFoam.pybFoam_core.volTensorField) -> None: ...
+
+@overload
+def invalidate_cache(field: pybFoam.pybFoam_core.volSymmTensorField) -> None: ...
+
+@overload
+def grad_many(fields: Sequence[pybFoam.pybFoam_core.volScalarField]) -> list[pybFoam.pybFoam_core.tmp_volVectorField]:
+    """
+    grad of every field; fields with the 'Gauss linear' scheme share one
+    loop over the faces
+    """
+
+@overload
+def grad_many(fields: Sequence[pybFoam.pybFoam_core.volVectorField]) -> list[pybFoam.pybFoam_core.tmp_volTensorField]: ...
+
+@overload
+def interpolate_many(fields: Sequence[pybFoam.pybFoam_core.volScalarField]) -> list[pybFoam.pybFoam_core.tmp_surfaceScalarField]:
+    """
+    interpolate of every field; fields with the 'linear' scheme share one
+    loop over the faces
+    """
+
+@overload
+def interpolate_many(fields: Sequence[pybFoam.pybFoam_core.volVectorField]) -> list[pybFoam.pybFoam_core.tmp_surfaceVectorField]: ...
+
+def set_num_threads(n: int) -> None:
+    """
+    Set the number of threads of interpolate, div and surfaceSum in this
+    module (n < 1: all cores). With one thread the OpenFOAM functions are
+    called
+    """
+
+def get_num_threads() -> int:
+    """Number of threads of interpolate, div and surfaceSum in this module"""
+
+class cellRegion:
+    """
+    Subset of the cells on which grad and div visit only the faces of
+    these cells. Results are NumPy arrays in the order of cells()
+    """
+
+    @overload
+    def __init__(self, mesh: pybFoam.pybFoam_core.fvMesh, cells: Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Region of the given cells"""
+
+    @overload
+    def __init__(self, mesh: pybFoam.pybFoam_core.fvMesh, zone: str) -> None:
+        """Region of the cells of a cellZone"""
+
+    def cells(self) -> Annotated[NDArray[numpy.int32], dict(writable=False)]:
+        """Region cells, read-only view"""
+
+    def size(self) -> int: ...
+
+    def __len__(self) -> int: ...
+
+    def nFaces(self) -> int:
+        """Number of faces visited by an operator"""
+
+    @overload
+    def grad(self, field: pybFoam.pybFoam_core.volScalarField) -> NDArray[numpy.float64]:
+        """grad of field in the region cells, shape (n, 3)"""
+
+    @overload
+    def grad(self, field: pybFoam.pybFoam_core.volVectorField) -> NDArray[numpy.float64]:
+        """grad of field in the region cells, shape (n, 9)"""
+
+    @overload
+    def div(self, field: pybFoam.pybFoam_core.volVectorField) -> NDArray[numpy.float64]: ...
+
+    @overload
+    def div(self, field: pybFoam.pybFoam_core.volSymmTensorField) -> NDArray[numpy.float64]: ...
+
+    @overload
+    def div(self, field: pybFoam.pybFoam_core.volTensorField) -> NDArray[numpy.float64]: ...
+
+    @overload
+    def div(self, flux: pybFoam.pybFoam_core.surfaceScalarField) -> NDArray[numpy.float64]: ...
+
+    @overload
+    def div(self, flux: pybFoam.pybFoam_core.surfaceScalarField, field: pybFoam.pybFoam_core.volScalarField) -> NDArray[numpy.float64]: ...
+
+    @overload
+    def div(self, flux: pybFoam.pybFoam_core.surfaceScalarField, field: pybFoam.pybFoam_core.volVectorField) -> NDArray[numpy.float64]: ...
@@ -18,14 +18,78 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "bind_fvc.hpp"
+#include "arrayExport.hpp"
+#include "bind_fields.hpp"
+#include "cellRegion.hpp"
+#include "fvcBatch.hpp"
+#include "fvcCache.hpp"
+#include "fvcThreaded.hpp"
+#include "parallelFor.hpp"
 
 #include "fvc.H"
 #include "volFields.H"
 #include "surfaceFields.H"
 
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+
 namespace Foam
 {
 
+// fvc operations on volume fields through the fvcCache, keyed on the
+// fvSchemes entry the operation reads; other field types are not cached
+
+template<class FieldType>
+auto cachedGrad(const FieldType& vf)
+{
+    return fvc::grad(vf);
+}
+
+template<class Type>
+tmp<GeometricField<typename outerProduct<vector, Type>::type, fvPatchField, volMesh>>
+cachedGrad(const GeometricField<Type, fvPatchField, volMesh>& vf)
+{
+    typedef GeometricField
+        <typename outerProduct<vector, Type>::type, fvPatchField, volMesh>
+        resultType;
+
+    return fvcCache::lookup<resultType>
+    (
+        "grad",
+        vf,
+        vf.mesh().gradScheme("grad(" + vf.name() + ')'),
+        [&vf]{ return fvc::grad(vf); }
+    );
+}
+
+template<class Type>
+tmp<GeometricField<Type, fvsPatchField, surfaceMesh>>
+cachedInterpolate(const GeometricField<Type, fvPatchField, volMesh>& vf)
+{
+    return fvcCache::lookup
+        <GeometricField<Type, fvsPatchField, surfaceMesh>>
+    (
+        "interpolate",
+        vf,
+        vf.mesh().interpolationScheme("interpolate(" + vf.name() + ')'),
+        [&vf]{ return fvc::threaded::interpolate(vf); }
+    );
+}
+
+template<class Type>
+tmp<GeometricField<Type, fvsPatchField, surfaceMesh>>
+cachedSnGrad(const GeometricField<Type, fvPatchField, volMesh>& vf)
+{
+    return fvcCache::lookup
+        <GeometricField<Type, fvsPatchField, surfaceMesh>>
+    (
+        "snGrad",
+        vf,
+        vf.mesh().snGradScheme("snGrad(" + vf.name() + ')'),
+        [&vf]{ return fvc::snGrad(vf); }
+    );
+}
+
 // Template helper functions for binding fvc operations
 
 // Single argument operations (grad, div, laplacian, interpolate, snGrad, reconstruct, flux)
@@ -40,7 +104,7 @@ void bindUnaryOp(nanobind::module_& m, const char* opName)
 template<class FieldType>
 void bindGrad(nanobind::module_& m)
 {
-    m.def("grad", [](const FieldType& vf){return fvc::grad(vf);});
+    m.def("grad", [](const FieldType& vf){return cachedGrad(vf);});
     m.def("grad", [](const tmp<FieldType>& vf){return fvc::grad(vf);});
 }
 
@@ -48,16 +112,16 @@ void bindGrad(nanobind::module_& m)
 template<class FieldType>
 void bindDiv(nanobind::module_& m)
 {
-    m.def("div", [](const FieldType& vf){return fvc::div(vf);});
-    m.def("div", [](const tmp<FieldType>& vf){return fvc::div(vf);});
+    m.def("div", [](const FieldType& vf){return fvc::threaded::div(vf);});
+    m.def("div", [](const tmp<FieldType>& vf){return fvc::threaded::div(vf());});
 }
 
 // Specialized template for div-convection operation (2 arguments)
 template<class FieldType>
 void bindDivConvection(nanobind::module_& m)
 {
-    m.def("div", [](const surfaceScalarField& ssf, const FieldType& vf){return fvc::div(ssf, vf);});
-    m.def("div", [](const surfaceScalarField& ssf, const tmp<FieldType>& vf){return fvc::div(ssf, vf);});
+    m.def("div", [](const surfaceScalarField& ssf, const FieldType& vf){return fvc::threaded::div(ssf, vf);});
+    m.def("div", [](const surfaceScalarField& ssf, const tmp<FieldType>& vf){return fvc::threaded::div(ssf, vf());});
 }
 
 // Specialized template for laplacian operation
@@ -86,15 +150,23 @@ void bindLaplacianWithDiff(nanobind::module_& m)
 template<class FieldType>
 void bindInterpolate(nanobind::module_& m)
 {
-    m.def("interpolate", [](const FieldType& vf){return fvc::interpolate(vf);});
-    m.def("interpolate", [](const tmp<FieldType>& vf){return fvc::interpolate(vf);});
+    m.def("interpolate", [](const FieldType& vf){return cachedInterpolate(vf);});
+    m.def("interpolate", [](const tmp<FieldType>& vf){return fvc::threaded::interpolate(vf());});
+}
+
+// Specialized template for surfaceSum operation
+template<class FieldType>
+void bindSurfaceSum(nanobind::module_& m)
+{
+    m.def("surfaceSum", [](const FieldType& ssf){return fvc::threaded::surfaceSum(ssf);});
+    m.def("surfaceSum", [](const tmp<FieldType>& ssf){return fvc::threaded::surfaceSum(ssf());});
 }
 
 // Specialized template for snGrad operation
 template<class FieldType>
 void bindSnGrad(nanobind::module_& m)
 {
-    m.def("snGrad", [](const FieldType& vf){return fvc::snGrad(vf);});
+    m.def("snGrad", [](const FieldType& vf){return cachedSnGrad(vf);});
     m.def("snGrad", [](const tmp<FieldType>& vf){return fvc::snGrad(vf);});
 }
 
@@ -122,6 +194,150 @@ void bindFluxWithPhi(nanobind::module_& m)
     m.def("flux", [](const surfaceScalarField& ssf, const tmp<FieldType>& vf){return fvc::flux(ssf, vf);});
 }
 
+// nanobind passes None list elements as nullptr
+template<class FieldType>
+const std::vector<const FieldType*>& checkFields
+(
+    const std::vector<const FieldType*>& fields
+)
+{
+    for (size_t i = 0; i < fields.size(); ++i)
+    {
+        if (!fields[i])
+        {
+            throw nanobind::type_error
+            (
+                ("fields[" + std::to_string(i) + "] is None").c_str()
+            );
+        }
+    }
+    return fields;
+}
+
+// grad and interpolate of a list of fields in one pass over the faces
+template<class Type>
+void bindMany(nanobind::module_& m)
+{
+    typedef GeometricField<Type, fvPatchField, volMesh> fieldType;
+
+    m.def("grad_many",
+        [](const std::vector<const fieldType*>& fields){ return fvc::gradMany(checkFields(fields)); },
+        nanobind::arg("fields"),
+        "grad of every field; fields with the 'Gauss linear' scheme share one\n"
+        "loop over the faces");
+    m.def("interpolate_many",
+        [](const std::vector<const fieldType*>& fields){ return fvc::interpolateMany(checkFields(fields)); },
+        nanobind::arg("fields"),
+        "interpolate of every field; fields with the 'linear' scheme share one\n"
+        "loop over the faces");
+}
+
+// Drop the cached results of a field
+template<class FieldType>
+void bindInvalidateCache(nanobind::module_& m)
+{
+    m.def("invalidate_cache",
+        [](const FieldType& vf){ fvcCache::invalidate(vf); },
+        nanobind::arg("field"),
+        "Drop the cached results of field, needed after writing to it\n"
+        "through a NumPy view");
+}
+
+// fvc operators on the cells of a cellRegion, results as NumPy arrays
+void bindCellRegion(nanobind::module_& m)
+{
+    namespace nb = nanobind;
+
+    nb::class_<cellRegion>(m, "cellRegion",
+        "Subset of the cells on which grad and div visit only the faces of\n"
+        "these cells. Results are NumPy arrays in the order of cells()")
+        .def("__init__",
+            [](cellRegion* self, const fvMesh& mesh, const labelArray& cells)
+            {
+                if (cells.ndim() != 1)
+                {
+                    throw std::runtime_error("cellRegion: expected a 1-D array of cells");
+                }
+                new (self) cellRegion
+                (
+                    mesh,
+                    UList<label>(const_cast<label*>(cells.data()), label(cells.shape(0)))
+                );
+            },
+            nb::arg("mesh"), nb::arg("cells"), nb::keep_alive<1, 2>(),
+            "Region of the given cells")
+        .def("__init__",
+            [](cellRegion* self, const fvMesh& mesh, const std::string& zone)
+            {
+                new (self) cellRegion(mesh, word(zone));
+            },
+            nb::arg("mesh"), nb::arg("zone"), nb::keep_alive<1, 2>(),
+            "Region of the cells of a cellZone")
+        .def("cells",
+            [](nb::handle self)
+            {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const cellRegion&>(self).cells(), self
+                );
+            },
+            "Region cells, read-only view")
+        .def("size", &cellRegion::size)
+        .def("__len__", &cellRegion::size)
+        .def("nFaces", &cellRegion::nFaces,
+            "Number of faces visited by an operator")
+        .def("grad",
+            [](const cellRegion& self, const volScalarField& vf)
+            {
+                return arrayExport::numpyArray(self.grad(vf));
+            },
+            nb::arg("field"),
+            "grad of field in the region cells, shape (n, 3)")
+        .def("grad",
+            [](const cellRegion& self, const volVectorField& vf)
+            {
+                return arrayExport::numpyArray(self.grad(vf));
+            },
+            nb::arg("field"),
+            "grad of field in the region cells, shape (n, 9)")
+        .def("div",
+            [](const cellRegion& self, const volVectorField& vf)
+            {
+                return arrayExport::numpyArray(self.div(vf));
+            },
+            nb::arg("field"))
+        .def("div",
+            [](const cellRegion& self, const volSymmTensorField& vf)
+            {
+                return arrayExport::numpyArray(self.div(vf));
+            },
+            nb::arg("field"))
+        .def("div",
+            [](const cellRegion& self, const volTensorField& vf)
+            {
+                return arrayExport::numpyArray(self.div(vf));
+            },
+            nb::arg("field"))
+        .def("div",
+            [](const cellRegion& self, const surfaceScalarField& ssf)
+            {
+                return arrayExport::numpyArray(self.div(ssf));
+            },
+            nb::arg("flux"))
+        .def("div",
+            [](const cellRegion& self, const surfaceScalarField& flux, const volScalarField& vf)
+            {
+                return arrayExport::numpyArray(self.div(flux, vf));
+            },
+            nb::arg("flux"), nb::arg("field"))
+        .def("div",
+            [](const cellRegion& self, const surfaceScalarField& flux, const volVectorField& vf)
+            {
+                return arrayExport::numpyArray(self.div(flux, vf));
+            },
+            nb::arg("flux"), nb::arg("field"));
+}
+
 } // End namespace Foam
 
 
@@ -178,6 +394,10 @@ void Foam::bindFVC(nanobind::module_& fvc)
     bindInterpolate<volTensorField>(fvc);
     bindInterpolate<volSymmTensorField>(fvc);
 
+    // surfaceSum operations
+    bindSurfaceSum<surfaceScalarField>(fvc);
+    bindSurfaceSum<surfaceVectorField>(fvc);
+
     // flux operations
     bindFlux<volVectorField>(fvc);
     bindFluxWithPhi<volVectorField>(fvc);
@@ -190,6 +410,46 @@ void Foam::bindFVC(nanobind::module_& fvc)
     bindReconstruct<surfaceScalarField>(fvc);
     bindReconstruct<surfaceVectorField>(fvc);
 
+    // batched grad and interpolate
+    bindMany<scalar>(fvc);
+    bindMany<vector>(fvc);
+
+    // result cache of grad, interpolate and snGrad
+    fvc.def("enable_cache",
+        [](const bool on){ fvcCache::enable(on); },
+        nanobind::arg("on") = true,
+        "Cache grad, interpolate and snGrad of volume fields on their mesh until\n"
+        "the field (event number), its fvSchemes entry, the time index or the\n"
+        "mesh changes. Disabling drops all entries");
+    fvc.def("cache_enabled", [](){ return fvcCache::enabled(); });
+    fvc.def("clear_cache", [](){ fvcCache::clear(); },
+        "Drop all entries and reset the statistics");
+    fvc.def("cache_stats",
+        []()
+        {
+            nanobind::dict stats;
+            stats["hits"] = fvcCache::hits();
+            stats["misses"] = fvcCache::misses();
+            stats["entries"] = fvcCache::size();
+            return stats;
+        },
+        "Number of hits, misses and stored entries");
+    bindInvalidateCache<volScalarField>(fvc);
+    bindInvalidateCache<volVectorField>(fvc);
+    bindInvalidateCache<volTensorField>(fvc);
+    bindInvalidateCache<volSymmTensorField>(fvc);
+
+    // thread pool of interpolate, div and surfaceSum
+    fvc.def("set_num_threads", &parallel::setNumThreads, nanobind::arg("n"),
+        "Set the number of threads of interpolate, div and surfaceSum in this\n"
+        "module (n < 1: all cores). With one thread the OpenFOAM functions are\n"
+        "called");
+    fvc.def("get_num_threads", &parallel::numThreads,
+        "Number of threads of interpolate, div and surfaceSum in this module");
+
+    // operators restricted to a subset of the cells
+    bindCellRegion(fvc);
+
     // ddtCorr (special case - single binding)
     fvc.def("ddtCorr", [](const volVectorField& vf, const surfaceScalarField& ssf){return fvc::ddtCorr(vf,ssf);});
 }
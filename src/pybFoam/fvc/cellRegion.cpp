@@ -0,0 +1,393 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "cellRegion.hpp"
+#include "fvcBatch.hpp"
+#include "fvcDiv.H"
+#include "fvcGrad.H"
+#include "DynamicList.H"
+#include "HashSet.H"
+#include "UIndirectList.H"
+
+#include <stdexcept>
+#include <string>
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace
+{
+
+using namespace Foam;
+
+//- Linear interpolate of a volume field on single faces
+template<class Type>
+class linearFaceValues
+{
+    const GeometricField<Type, fvPatchField, volMesh>& vf_;
+    const Field<Type>& psi_;
+    const scalarField& w_;
+    const labelUList& owner_;
+    const labelUList& neighbour_;
+
+    //- Neighbour values of the coupled patches of the region
+    PtrList<Field<Type>> patchNeighbour_;
+
+public:
+
+    linearFaceValues
+    (
+        const GeometricField<Type, fvPatchField, volMesh>& vf,
+        const labelUList& coupledPatches
+    )
+    :
+        vf_(vf),
+        psi_(vf.primitiveField()),
+        w_(vf.mesh().weights().primitiveField()),
+        owner_(vf.mesh().owner()),
+        neighbour_(vf.mesh().neighbour()),
+        patchNeighbour_(vf.mesh().boundary().size())
+    {
+        for (const label patchi : coupledPatches)
+        {
+            patchNeighbour_.set
+            (
+                patchi,
+                vf.boundaryField()[patchi].patchNeighbourField().ptr()
+            );
+        }
+    }
+
+    Type internal(const label facei) const
+    {
+        const Type& psiN = psi_[neighbour_[facei]];
+        return w_[facei]*(psi_[owner_[facei]] - psiN) + psiN;
+    }
+
+    Type boundary(const label patchi, const label facei) const
+    {
+        const fvPatchField<Type>& pvf = vf_.boundaryField()[patchi];
+        if (!pvf.coupled())
+        {
+            return pvf[facei];
+        }
+
+        const scalar pw = vf_.mesh().weights().boundaryField()[patchi][facei];
+        return
+            pw*psi_[pvf.patch().faceCells()[facei]]
+          + (1.0 - pw)*patchNeighbour_[patchi][facei];
+    }
+};
+
+} // End anonymous namespace
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+const Foam::labelList& Foam::cellRegion::zoneCells
+(
+    const fvMesh& mesh,
+    const word& zoneName
+)
+{
+    const label zonei = mesh.cellZones().findZoneID(zoneName);
+    if (zonei < 0)
+    {
+        throw std::runtime_error("cellRegion: no cellZone named " + zoneName);
+    }
+    return mesh.cellZones()[zonei];
+}
+
+
+template<class Result, class InternalFlux, class BoundaryFlux>
+Foam::List<Result> Foam::cellRegion::gaussSum
+(
+    const InternalFlux& internalFlux,
+    const BoundaryFlux& boundaryFlux
+) const
+{
+    const scalarField& V = mesh_.V();
+
+    List<Result> result(cells_.size());
+
+    forAll(cells_, k)
+    {
+        Result sum = Zero;
+
+        for (label i = internalStart_[k]; i < internalStart_[k + 1]; ++i)
+        {
+            const Result flux = internalFlux(internalFaces_[i]);
+            if (owned_[i])
+            {
+                sum += flux;
+            }
+            else
+            {
+                sum -= flux;
+            }
+        }
+
+        for (label i = boundaryStart_[k]; i < boundaryStart_[k + 1]; ++i)
+        {
+            sum += boundaryFlux(boundaryPatch_[i], boundaryFace_[i]);
+        }
+
+        result[k] = sum/V[cells_[k]];
+    }
+
+    return result;
+}
+
+
+template<class Type>
+Foam::List<Type> Foam::cellRegion::pick
+(
+    const tmp<GeometricField<Type, fvPatchField, volMesh>>& tvf
+) const
+{
+    return List<Type>(UIndirectList<Type>(tvf().primitiveField(), cells_));
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::cellRegion::cellRegion(const fvMesh& mesh, const labelUList& cells)
+:
+    mesh_(mesh),
+    cells_(cells),
+    internalStart_(cells.size() + 1, Zero),
+    internalFaces_(),
+    owned_(),
+    boundaryStart_(cells.size() + 1, Zero),
+    boundaryPatch_(),
+    boundaryFace_(),
+    coupledPatches_()
+{
+    const label nCells = mesh_.nCells();
+    const label nInternalFaces = mesh_.nInternalFaces();
+    const labelUList& owner = mesh_.owner();
+    const cellList& meshCells = mesh_.cells();
+    const polyBoundaryMesh& patches = mesh_.boundaryMesh();
+
+    DynamicList<label> internalFaces;
+    DynamicList<bool> owned;
+    DynamicList<label> boundaryPatch;
+    DynamicList<label> boundaryFace;
+    labelHashSet coupled;
+
+    forAll(cells_, k)
+    {
+        const label celli = cells_[k];
+        if (celli < 0 || celli >= nCells)
+        {
+            throw std::runtime_error
+            (
+                "cellRegion: cell " + std::to_string(celli)
+              + " is not in the mesh of " + std::to_string(nCells) + " cells"
+            );
+        }
+
+        for (const label facei : meshCells[celli])
+        {
+            if (facei < nInternalFaces)
+            {
+                internalFaces.push_back(facei);
+                owned.push_back(owner[facei] == celli);
+                continue;
+            }
+
+            const label patchi = patches.whichPatch(facei);
+            const fvPatch& fvp = mesh_.boundary()[patchi];
+
+            // Empty patches hold no face values
+            if (fvp.size() == 0)
+            {
+                continue;
+            }
+
+            boundaryPatch.push_back(patchi);
+            boundaryFace.push_back(facei - fvp.start());
+            if (fvp.coupled())
+            {
+                coupled.insert(patchi);
+            }
+        }
+
+        internalStart_[k + 1] = internalFaces.size();
+        boundaryStart_[k + 1] = boundaryPatch.size();
+    }
+
+    internalFaces_.transfer(internalFaces);
+    owned_.transfer(owned);
+    boundaryPatch_.transfer(boundaryPatch);
+    boundaryFace_.transfer(boundaryFace);
+    coupledPatches_ = coupled.sortedToc();
+}
+
+
+Foam::cellRegion::cellRegion(const fvMesh& mesh, const word& zoneName)
+:
+    cellRegion(mesh, zoneCells(mesh, zoneName))
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type>
+Foam::List<typename Foam::outerProduct<Foam::vector, Type>::type>
+Foam::cellRegion::grad
+(
+    const GeometricField<Type, fvPatchField, volMesh>& vf
+) const
+{
+    typedef typename outerProduct<vector, Type>::type GradType;
+
+    if (!fvc::schemeIs(mesh_.gradScheme("grad(" + vf.name() + ')'), {"Gauss", "linear"}))
+    {
+        return pick(fvc::grad(vf));
+    }
+
+    const linearFaceValues<Type> values(vf, coupledPatches_);
+    const surfaceVectorField& Sf = mesh_.Sf();
+    const vectorField& iSf = Sf.primitiveField();
+
+    return gaussSum<GradType>
+    (
+        [&](const label facei)
+        {
+            return iSf[facei]*values.internal(facei);
+        },
+        [&](const label patchi, const label facei)
+        {
+            return Sf.boundaryField()[patchi][facei]*values.boundary(patchi, facei);
+        }
+    );
+}
+
+
+template<class Type>
+Foam::List<typename Foam::innerProduct<Foam::vector, Type>::type>
+Foam::cellRegion::div
+(
+    const GeometricField<Type, fvPatchField, volMesh>& vf
+) const
+{
+    typedef typename innerProduct<vector, Type>::type DivType;
+
+    if (!fvc::schemeIs(mesh_.divScheme("div(" + vf.name() + ')'), {"Gauss", "linear"}))
+    {
+        return pick(fvc::div(vf));
+    }
+
+    const linearFaceValues<Type> values(vf, coupledPatches_);
+    const surfaceVectorField& Sf = mesh_.Sf();
+    const vectorField& iSf = Sf.primitiveField();
+
+    return gaussSum<DivType>
+    (
+        [&](const label facei)
+        {
+            return iSf[facei] & values.internal(facei);
+        },
+        [&](const label patchi, const label facei)
+        {
+            return Sf.boundaryField()[patchi][facei] & values.boundary(patchi, facei);
+        }
+    );
+}
+
+
+Foam::List<Foam::scalar> Foam::cellRegion::div
+(
+    const surfaceScalarField& ssf
+) const
+{
+    const scalarField& issf = ssf.primitiveField();
+
+    return gaussSum<scalar>
+    (
+        [&](const label facei)
+        {
+            return issf[facei];
+        },
+        [&](const label patchi, const label facei)
+        {
+            return ssf.boundaryField()[patchi][facei];
+        }
+    );
+}
+
+
+template<class Type>
+Foam::List<Type> Foam::cellRegion::div
+(
+    const surfaceScalarField& flux,
+    const GeometricField<Type, fvPatchField, volMesh>& vf
+) const
+{
+    const word name("div(" + flux.name() + ',' + vf.name() + ')');
+
+    if (!fvc::schemeIs(mesh_.divScheme(name), {"Gauss", "linear"}))
+    {
+        return pick(fvc::div(flux, vf));
+    }
+
+    const linearFaceValues<Type> values(vf, coupledPatches_);
+    const scalarField& iflux = flux.primitiveField();
+
+    return gaussSum<Type>
+    (
+        [&](const label facei)
+        {
+            return iflux[facei]*values.internal(facei);
+        },
+        [&](const label patchi, const label facei)
+        {
+            return flux.boundaryField()[patchi][facei]*values.boundary(patchi, facei);
+        }
+    );
+}
+
+
+// * * * * * * * * * * * * * Explicit Instantiations * * * * * * * * * * * * //
+
+namespace Foam
+{
+
+template
+List<vector> cellRegion::grad(const volScalarField&) const;
+
+template
+List<tensor> cellRegion::grad(const volVectorField&) const;
+
+template
+List<scalar> cellRegion::div(const volVectorField&) const;
+
+template
+List<vector> cellRegion::div(const volSymmTensorField&) const;
+
+template
+List<vector> cellRegion::div(const volTensorField&) const;
+
+template
+List<scalar> cellRegion::div(const surfaceScalarField&, const volScalarField&) const;
+
+template
+List<vector> cellRegion::div(const surfaceScalarField&, const volVectorField&) const;
+
+} // End namespace Foam
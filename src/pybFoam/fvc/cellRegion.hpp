@@ -0,0 +1,165 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::cellRegion
+
+Description
+    fvc operators evaluated on a subset of the cells, e.g. a cellZone.
+
+    The faces of the selected cells are collected once on construction
+    (internal faces with their orientation, boundary faces as patch and
+    patch face). Each operator then visits only these faces, so the cost
+    scales with the size of the region instead of the mesh. The results
+    are the values of the region cells, in the order of cells().
+
+    Gauss linear grad and div are computed on the region faces; they equal
+    fvc::grad / fvc::div in the region cells. For fields with other
+    schemes the OpenFOAM operator is evaluated on the whole mesh and the
+    region values are picked from the result.
+
+SourceFiles
+    cellRegion.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_cellRegion
+#define foam_cellRegion
+
+#include "volFields.H"
+#include "surfaceFields.H"
+
+namespace Foam
+{
+
+class cellRegion
+{
+    // Private Data
+
+        const fvMesh& mesh_;
+
+        //- The region cells
+        labelList cells_;
+
+        //- Internal faces of cell k: internalFaces_[internalStart_[k] ...
+        //  internalStart_[k + 1] - 1]
+        labelList internalStart_;
+        labelList internalFaces_;
+
+        //- True if the region cell is the owner of the internal face
+        boolList owned_;
+
+        //- Boundary faces of cell k as (patch, patch face), CSR like the
+        //  internal faces
+        labelList boundaryStart_;
+        labelList boundaryPatch_;
+        labelList boundaryFace_;
+
+        //- Coupled patches with faces in the region
+        labelList coupledPatches_;
+
+
+    // Private Member Functions
+
+        //- Cells of the cellZone zoneName
+        static const labelList& zoneCells
+        (
+            const fvMesh& mesh,
+            const word& zoneName
+        );
+
+        //- Sum over the region faces of internalFlux(facei), counted
+        //  negative for neighbour faces, and boundaryFlux(patchi, facei),
+        //  divided by the cell volume
+        template<class Result, class InternalFlux, class BoundaryFlux>
+        List<Result> gaussSum
+        (
+            const InternalFlux& internalFlux,
+            const BoundaryFlux& boundaryFlux
+        ) const;
+
+        //- Region values of a field computed on the whole mesh
+        template<class Type>
+        List<Type> pick
+        (
+            const tmp<GeometricField<Type, fvPatchField, volMesh>>& tvf
+        ) const;
+
+
+public:
+
+    // Constructors
+
+        //- Construct from a list of cells
+        cellRegion(const fvMesh& mesh, const labelUList& cells);
+
+        //- Construct from the cells of a cellZone
+        cellRegion(const fvMesh& mesh, const word& zoneName);
+
+
+    // Member Functions
+
+        const fvMesh& mesh() const
+        {
+            return mesh_;
+        }
+
+        const labelList& cells() const
+        {
+            return cells_;
+        }
+
+        label size() const
+        {
+            return cells_.size();
+        }
+
+        //- Number of region faces visited by an operator
+        label nFaces() const
+        {
+            return internalFaces_.size() + boundaryFace_.size();
+        }
+
+        //- fvc::grad(vf) in the region cells
+        template<class Type>
+        List<typename outerProduct<vector, Type>::type> grad
+        (
+            const GeometricField<Type, fvPatchField, volMesh>& vf
+        ) const;
+
+        //- fvc::div(vf) in the region cells
+        template<class Type>
+        List<typename innerProduct<vector, Type>::type> div
+        (
+            const GeometricField<Type, fvPatchField, volMesh>& vf
+        ) const;
+
+        //- fvc::div(ssf) in the region cells
+        List<scalar> div(const surfaceScalarField& ssf) const;
+
+        //- fvc::div(flux, vf) in the region cells
+        template<class Type>
+        List<Type> div
+        (
+            const surfaceScalarField& flux,
+            const GeometricField<Type, fvPatchField, volMesh>& vf
+        ) const;
+};
+
+} // End namespace Foam
+
+#endif
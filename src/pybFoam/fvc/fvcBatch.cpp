@@ -0,0 +1,265 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "fvcBatch.hpp"
+#include "fvcGrad.H"
+#include "fvcInterpolate.H"
+#include "gaussGrad.H"
+#include "extrapolatedCalculatedFvPatchFields.H"
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace
+{
+
+using namespace Foam;
+
+//- Fused internal face loop: f(facei, k, faceValue) for every field k
+template<class Type, class FaceOp>
+void forAllFaceValues
+(
+    const fvMesh& mesh,
+    const std::vector<const Type*>& psi,
+    FaceOp&& f
+)
+{
+    const labelUList& owner = mesh.owner();
+    const labelUList& neighbour = mesh.neighbour();
+    const scalarField& w = mesh.weights().primitiveField();
+    const size_t nFields = psi.size();
+
+    for (label facei = 0; facei < mesh.nInternalFaces(); ++facei)
+    {
+        const label own = owner[facei];
+        const label nei = neighbour[facei];
+        const scalar wf = w[facei];
+
+        for (size_t k = 0; k < nFields; ++k)
+        {
+            f(facei, own, nei, k, wf*(psi[k][own] - psi[k][nei]) + psi[k][nei]);
+        }
+    }
+}
+
+} // End anonymous namespace
+
+
+// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * //
+
+template<class Type>
+std::vector<Foam::tmp<Foam::GeometricField<typename Foam::outerProduct<Foam::vector, Type>::type, Foam::fvPatchField, Foam::volMesh>>>
+Foam::fvc::gradMany
+(
+    const std::vector<const GeometricField<Type, fvPatchField, volMesh>*>& fields
+)
+{
+    typedef typename outerProduct<vector, Type>::type GradType;
+    typedef GeometricField<GradType, fvPatchField, volMesh> gradFieldType;
+
+    std::vector<tmp<gradFieldType>> results(fields.size());
+
+    // Fields for the fused loop, all others are done one by one
+    std::vector<size_t> fused;
+    for (size_t k = 0; k < fields.size(); ++k)
+    {
+        const auto& vf = *fields[k];
+        if
+        (
+            &vf.mesh() == &fields[0]->mesh()
+         && fvc::schemeIs(vf.mesh().gradScheme("grad(" + vf.name() + ')'), {"Gauss", "linear"})
+        )
+        {
+            fused.push_back(k);
+        }
+        else
+        {
+            results[k] = fvc::grad(vf);
+        }
+    }
+
+    if (fused.empty())
+    {
+        return results;
+    }
+
+    const fvMesh& mesh = fields[fused[0]]->mesh();
+    const vectorField& Sf = mesh.Sf().primitiveField();
+
+    std::vector<const Type*> psi;
+    std::vector<GradType*> grad;
+    for (const size_t k : fused)
+    {
+        const auto& vf = *fields[k];
+        results[k] = gradFieldType::New
+        (
+            "grad(" + vf.name() + ')',
+            mesh,
+            dimensioned<GradType>(vf.dimensions()/dimLength, Zero),
+            extrapolatedCalculatedFvPatchField<GradType>::typeName
+        );
+        psi.push_back(vf.primitiveField().cdata());
+        grad.push_back(results[k].ref().primitiveFieldRef().data());
+    }
+
+    forAllFaceValues<Type>
+    (
+        mesh,
+        psi,
+        [&](const label facei, const label own, const label nei, const size_t k, const Type& value)
+        {
+            const GradType Sfv = Sf[facei]*value;
+            grad[k][own] += Sfv;
+            grad[k][nei] -= Sfv;
+        }
+    );
+
+    for (const size_t k : fused)
+    {
+        const auto& vf = *fields[k];
+        gradFieldType& gGrad = results[k].ref();
+        Field<GradType>& igGrad = gGrad.primitiveFieldRef();
+
+        forAll(mesh.boundary(), patchi)
+        {
+            const labelUList& faceCells = mesh.boundary()[patchi].faceCells();
+            const vectorField& pSf = mesh.Sf().boundaryField()[patchi];
+            const tmp<Field<Type>> tpssf = fvc::linearPatchValues(vf, patchi);
+            const Field<Type>& pssf = tpssf();
+
+            forAll(faceCells, facei)
+            {
+                igGrad[faceCells[facei]] += pSf[facei]*pssf[facei];
+            }
+        }
+
+        igGrad /= mesh.V();
+        gGrad.correctBoundaryConditions();
+        fv::gaussGrad<Type>::correctBoundaryConditions(vf, gGrad);
+    }
+
+    return results;
+}
+
+
+template<class Type>
+std::vector<Foam::tmp<Foam::GeometricField<Type, Foam::fvsPatchField, Foam::surfaceMesh>>>
+Foam::fvc::interpolateMany
+(
+    const std::vector<const GeometricField<Type, fvPatchField, volMesh>*>& fields
+)
+{
+    typedef GeometricField<Type, fvsPatchField, surfaceMesh> surfaceFieldType;
+
+    std::vector<tmp<surfaceFieldType>> results(fields.size());
+
+    std::vector<size_t> fused;
+    for (size_t k = 0; k < fields.size(); ++k)
+    {
+        const auto& vf = *fields[k];
+        if
+        (
+            &vf.mesh() == &fields[0]->mesh()
+         && fvc::schemeIs
+            (
+                vf.mesh().interpolationScheme("interpolate(" + vf.name() + ')'),
+                {"linear"}
+            )
+        )
+        {
+            fused.push_back(k);
+        }
+        else
+        {
+            results[k] = fvc::interpolate(vf);
+        }
+    }
+
+    if (fused.empty())
+    {
+        return results;
+    }
+
+    const fvMesh& mesh = fields[fused[0]]->mesh();
+
+    std::vector<const Type*> psi;
+    std::vector<Type*> faceValues;
+    for (const size_t k : fused)
+    {
+        const auto& vf = *fields[k];
+        results[k] = surfaceFieldType::New
+        (
+            "interpolate(" + vf.name() + ')',
+            mesh,
+            dimensioned<Type>(vf.dimensions(), Zero)
+        );
+        psi.push_back(vf.primitiveField().cdata());
+        faceValues.push_back(results[k].ref().primitiveFieldRef().data());
+    }
+
+    forAllFaceValues<Type>
+    (
+        mesh,
+        psi,
+        [&](const label facei, const label, const label, const size_t k, const Type& value)
+        {
+            faceValues[k][facei] = value;
+        }
+    );
+
+    for (const size_t k : fused)
+    {
+        auto& bsf = results[k].ref().boundaryFieldRef();
+        forAll(bsf, patchi)
+        {
+            bsf[patchi] = fvc::linearPatchValues(*fields[k], patchi);
+        }
+    }
+
+    return results;
+}
+
+
+// * * * * * * * * * * * * * Explicit Instantiations * * * * * * * * * * * * //
+
+namespace Foam
+{
+namespace fvc
+{
+
+template
+std::vector<tmp<volVectorField>>
+gradMany(const std::vector<const volScalarField*>&);
+
+template
+std::vector<tmp<volTensorField>>
+gradMany(const std::vector<const volVectorField*>&);
+
+template
+std::vector<tmp<surfaceScalarField>>
+interpolateMany(const std::vector<const volScalarField*>&);
+
+template
+std::vector<tmp<surfaceVectorField>>
+interpolateMany(const std::vector<const volVectorField*>&);
+
+} // End namespace fvc
+} // End namespace Foam
+
+
+// ************************************************************************* //
@@ -0,0 +1,103 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+InNamespace
+    Foam::fvc
+
+Description
+    fvc operators applied to several fields in one pass over the faces.
+
+    Fields whose fvSchemes entry is 'Gauss linear' (grad) or 'linear'
+    (interpolate) share a single loop: owner, neighbour, weight and face
+    area vector are loaded once per face for all fields. Fields with other
+    schemes are evaluated one by one with fvc::grad / fvc::interpolate.
+    The results equal those of the single-field calls.
+
+SourceFiles
+    fvcBatch.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_fvcBatch
+#define foam_fvcBatch
+
+#include "volFields.H"
+#include "surfaceFields.H"
+
+#include <initializer_list>
+#include <vector>
+
+namespace Foam
+{
+namespace fvc
+{
+
+//- True if the scheme entry consists of exactly these words
+inline bool schemeIs(const ITstream& is, std::initializer_list<const char*> words)
+{
+    if (is.size() != label(words.size()))
+    {
+        return false;
+    }
+
+    label i = 0;
+    for (const char* w : words)
+    {
+        const token& tok = is[i++];
+        if (!tok.isWord() || tok.wordToken() != w)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+//- Linear interpolate of vf on one patch: the patch values, or the
+//  weighted internal and neighbour values on coupled patches
+template<class Type>
+tmp<Field<Type>> linearPatchValues
+(
+    const GeometricField<Type, fvPatchField, volMesh>& vf,
+    const label patchi
+)
+{
+    const fvPatchField<Type>& pvf = vf.boundaryField()[patchi];
+    if (!pvf.coupled())
+    {
+        return tmp<Field<Type>>::New(pvf);
+    }
+
+    const scalarField& pw = vf.mesh().weights().boundaryField()[patchi];
+    return
+        pw*pvf.patchInternalField()
+      + (1.0 - pw)*pvf.patchNeighbourField();
+}
+
+
+template<class Type>
+std::vector<tmp<GeometricField<typename outerProduct<vector, Type>::type, fvPatchField, volMesh>>>
+gradMany(const std::vector<const GeometricField<Type, fvPatchField, volMesh>*>& fields);
+
+template<class Type>
+std::vector<tmp<GeometricField<Type, fvsPatchField, surfaceMesh>>>
+interpolateMany(const std::vector<const GeometricField<Type, fvPatchField, volMesh>*>& fields);
+
+} // End namespace fvc
+} // End namespace Foam
+
+#endif
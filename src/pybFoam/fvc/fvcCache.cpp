@@ -0,0 +1,203 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "fvcCache.hpp"
+
+namespace Foam
+{
+    defineTypeNameAndDebug(fvcCache, 0);
+}
+
+
+// * * * * * * * * * * * * * Static Member Functions * * * * * * * * * * * * //
+
+Foam::fvcCache::state& Foam::fvcCache::global()
+{
+    // Never destroyed: meshes holding a cache may outlive it at exit
+    static state* s = new state();
+    return *s;
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::fvcCache::fvcCache(const fvMesh& mesh)
+:
+    MeshObject<fvMesh, GeometricMeshObject, fvcCache>(mesh),
+    entries_()
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    g.caches.insert(this);
+}
+
+
+// * * * * * * * * * * * * * * * * Destructor  * * * * * * * * * * * * * * * //
+
+Foam::fvcCache::~fvcCache()
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    g.caches.erase(this);
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+std::shared_ptr<const void> Foam::fvcCache::find
+(
+    const void* field,
+    const word& fieldName,
+    const std::string& op,
+    const label eventNo,
+    const label timeIndex,
+    const std::string& scheme
+) const
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+
+    const auto iter = entries_.find({fieldName, op});
+    if (iter == entries_.end())
+    {
+        ++g.misses;
+        return nullptr;
+    }
+
+    const entry& e = iter->second;
+    if
+    (
+        e.field == field
+     && e.eventNo == eventNo
+     && e.timeIndex == timeIndex
+     && e.scheme == scheme
+    )
+    {
+        ++g.hits;
+        return e.result;
+    }
+
+    entries_.erase(iter);
+    ++g.misses;
+    return nullptr;
+}
+
+
+void Foam::fvcCache::store
+(
+    const word& fieldName,
+    const std::string& op,
+    entry&& e
+) const
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    if (g.enabled)
+    {
+        entries_[{fieldName, op}] = std::move(e);
+    }
+}
+
+
+void Foam::fvcCache::invalidate(const word& fieldName) const
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    for (auto iter = entries_.begin(); iter != entries_.end();)
+    {
+        if (iter->first.first == fieldName)
+        {
+            iter = entries_.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+bool Foam::fvcCache::enabled()
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    return g.enabled;
+}
+
+
+void Foam::fvcCache::enable(const bool on)
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    g.enabled = on;
+    if (!on)
+    {
+        for (const fvcCache* cache : g.caches)
+        {
+            cache->entries_.clear();
+        }
+    }
+}
+
+
+void Foam::fvcCache::clear()
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    for (const fvcCache* cache : g.caches)
+    {
+        cache->entries_.clear();
+    }
+    g.hits = 0;
+    g.misses = 0;
+}
+
+
+Foam::label Foam::fvcCache::hits()
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    return g.hits;
+}
+
+
+Foam::label Foam::fvcCache::misses()
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    return g.misses;
+}
+
+
+Foam::label Foam::fvcCache::size()
+{
+    state& g = global();
+    std::lock_guard<std::mutex> lock(g.mutex);
+    label n = 0;
+    for (const fvcCache* cache : g.caches)
+    {
+        n += label(cache->entries_.size());
+    }
+    return n;
+}
+
+
+// ************************************************************************* //
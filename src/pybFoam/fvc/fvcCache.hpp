@@ -0,0 +1,214 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::fvcCache
+
+Description
+    Opt-in cache of fvc results of fields (grad, interpolate, snGrad).
+
+    The entries of a mesh are stored on the mesh as a GeometricMeshObject,
+    so they are deleted with the mesh and dropped on mesh motion or
+    topology changes. An entry is keyed by the operation and the field
+    name and is valid while the field (address), its event number
+    (regIOobject::eventNo, advanced by every non-const access such as
+    ref(), boundaryFieldRef() or correctBoundaryConditions()), the scheme
+    entry in fvSchemes and the time index are unchanged. A stale entry is
+    dropped on lookup. A hit returns a copy of the stored result.
+
+    Writes through NumPy views of a field do not advance the event number;
+    invalidate() the field (or clear()) after such writes.
+
+SourceFiles
+    fvcCache.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_fvcCache
+#define foam_fvcCache
+
+#include "MeshObject.H"
+#include "fvMesh.H"
+#include "ITstream.H"
+#include "OStringStream.H"
+#include "tmp.H"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+
+namespace Foam
+{
+
+class fvcCache
+:
+    public MeshObject<fvMesh, GeometricMeshObject, fvcCache>
+{
+    // Private Data
+
+        struct entry
+        {
+            const void* field;
+            label eventNo;
+            label timeIndex;
+            std::string scheme;
+            std::shared_ptr<const void> result;
+        };
+
+        //- Keyed by (field name, operation)
+        mutable std::map<std::pair<word, std::string>, entry> entries_;
+
+        //- Settings and statistics shared by the caches of all meshes
+        struct state
+        {
+            bool enabled = false;
+            label hits = 0;
+            label misses = 0;
+            std::set<const fvcCache*> caches;
+            std::mutex mutex;
+        };
+
+        static state& global();
+
+
+    // Private Member Functions
+
+        //- The stored result if valid, counting the hit or miss.
+        //  A stale entry is dropped
+        std::shared_ptr<const void> find
+        (
+            const void* field,
+            const word& fieldName,
+            const std::string& op,
+            const label eventNo,
+            const label timeIndex,
+            const std::string& scheme
+        ) const;
+
+        void store
+        (
+            const word& fieldName,
+            const std::string& op,
+            entry&& e
+        ) const;
+
+        //- Drop the entries computed from the field called fieldName
+        void invalidate(const word& fieldName) const;
+
+
+public:
+
+    //- Runtime type information
+    TypeName("fvcCache");
+
+
+    // Constructors
+
+        explicit fvcCache(const fvMesh& mesh);
+
+        fvcCache(const fvcCache&) = delete;
+        void operator=(const fvcCache&) = delete;
+
+
+    //- Destructor
+    ~fvcCache();
+
+
+    // Static Member Functions
+
+        static bool enabled();
+
+        //- Enable or disable; disabling drops all entries
+        static void enable(const bool on);
+
+        //- Drop the entries of all meshes and reset the statistics
+        static void clear();
+
+        static label hits();
+
+        static label misses();
+
+        //- Number of entries of all meshes
+        static label size();
+
+        //- Drop the entries computed from vf
+        template<class FieldType>
+        static void invalidate(const FieldType& vf)
+        {
+            const fvcCache* cache =
+                vf.mesh().thisDb().template findObject<fvcCache>(typeName);
+            if (cache)
+            {
+                cache->invalidate(vf.name());
+            }
+        }
+
+        //- Result of compute() for op applied to vf, from the cache of the
+        //  mesh of vf if valid. scheme is the fvSchemes entry used by the
+        //  operation
+        template<class Result, class FieldType, class Compute>
+        static tmp<Result> lookup
+        (
+            const std::string& op,
+            const FieldType& vf,
+            const ITstream& scheme,
+            Compute&& compute
+        )
+        {
+            if (!enabled())
+            {
+                return compute();
+            }
+
+            OStringStream os;
+            os << scheme;
+            const std::string schemeText = os.str();
+
+            const label eventNo = vf.eventNo();
+            const label timeIndex = vf.mesh().time().timeIndex();
+
+            const fvcCache& cache = New(vf.mesh());
+
+            const std::shared_ptr<const void> cached = cache.find
+            (
+                &vf, vf.name(), op, eventNo, timeIndex, schemeText
+            );
+            if (cached)
+            {
+                return tmp<Result>::New(*static_cast<const Result*>(cached.get()));
+            }
+
+            tmp<Result> tresult = compute();
+            std::shared_ptr<const Result> stored(new Result(tresult()));
+
+            cache.store
+            (
+                vf.name(),
+                op,
+                entry{&vf, eventNo, timeIndex, schemeText, std::move(stored)}
+            );
+
+            return tresult;
+        }
+};
+
+} // End namespace Foam
+
+#endif
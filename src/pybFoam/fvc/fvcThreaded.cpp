@@ -0,0 +1,465 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "fvcThreaded.hpp"
+#include "fvcBatch.hpp"
+#include "parallelFor.hpp"
+#include "fvcDiv.H"
+#include "fvcInterpolate.H"
+#include "fvcSurfaceIntegrate.H"
+#include "extrapolatedCalculatedFvPatchFields.H"
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace
+{
+
+using namespace Foam;
+
+//- result[celli] = sum of the internal face values of the faces owned by
+//  celli, plus (or minus with Subtract) the sum over its neighbour faces.
+//  Threaded over cells, every thread writes only its own cells.
+template<bool Subtract, class Type>
+void gatherInternalFaces
+(
+    const fvMesh& mesh,
+    const UList<Type>& faceValues,
+    UList<Type>& result
+)
+{
+    // Demand-driven addressing, created here before the threads start
+    const lduAddressing& addr = mesh.lduAddr();
+    const labelUList& ownerStart = addr.ownerStartAddr();
+    const labelUList& losort = addr.losortAddr();
+    const labelUList& losortStart = addr.losortStartAddr();
+
+    parallel::parallelFor
+    (
+        mesh.nCells(),
+        [&](const label start, const label end)
+        {
+            for (label celli = start; celli < end; ++celli)
+            {
+                Type sum = Zero;
+
+                for (label facei = ownerStart[celli]; facei < ownerStart[celli + 1]; ++facei)
+                {
+                    sum += faceValues[facei];
+                }
+
+                for (label i = losortStart[celli]; i < losortStart[celli + 1]; ++i)
+                {
+                    if constexpr (Subtract)
+                    {
+                        sum -= faceValues[losort[i]];
+                    }
+                    else
+                    {
+                        sum += faceValues[losort[i]];
+                    }
+                }
+
+                result[celli] = sum;
+            }
+        }
+    );
+}
+
+
+//- Sum of ssf over the faces of every cell, the neighbour faces counted
+//  negative and the sum divided by the cell volume unless Sum
+template<bool Sum, class Type>
+void integrate
+(
+    const GeometricField<Type, fvsPatchField, surfaceMesh>& ssf,
+    Field<Type>& result
+)
+{
+    const fvMesh& mesh = ssf.mesh();
+
+    gatherInternalFaces<!Sum>(mesh, ssf.primitiveField(), result);
+
+    forAll(mesh.boundary(), patchi)
+    {
+        const labelUList& faceCells = mesh.boundary()[patchi].faceCells();
+        const fvsPatchField<Type>& pssf = ssf.boundaryField()[patchi];
+
+        forAll(faceCells, facei)
+        {
+            result[faceCells[facei]] += pssf[facei];
+        }
+    }
+
+    if (!Sum)
+    {
+        const tmp<DimensionedField<scalar, volMesh>> tV = mesh.Vsc();
+        const scalarField& V = tV();
+
+        parallel::parallelFor
+        (
+            mesh.nCells(),
+            [&](const label start, const label end)
+            {
+                for (label celli = start; celli < end; ++celli)
+                {
+                    result[celli] /= V[celli];
+                }
+            }
+        );
+    }
+}
+
+
+//- Surface field with the internal values f(facei, linear interpolate of
+//  vf) and the boundary values patchOp(patchi, patch values of vf)
+template<class Result, class Type, class FaceOp, class PatchOp>
+tmp<GeometricField<Result, fvsPatchField, surfaceMesh>> linearFaceField
+(
+    const word& name,
+    const dimensionSet& dims,
+    const GeometricField<Type, fvPatchField, volMesh>& vf,
+    const FaceOp& faceOp,
+    const PatchOp& patchOp
+)
+{
+    typedef GeometricField<Result, fvsPatchField, surfaceMesh> surfaceFieldType;
+
+    const fvMesh& mesh = vf.mesh();
+    tmp<surfaceFieldType> tsf =
+        surfaceFieldType::New(name, mesh, dimensioned<Result>(dims, Zero));
+    surfaceFieldType& sf = tsf.ref();
+
+    // Demand-driven geometry, created here before the threads start
+    const labelUList& owner = mesh.owner();
+    const labelUList& neighbour = mesh.neighbour();
+    const scalarField& w = mesh.weights().primitiveField();
+    const Field<Type>& psi = vf.primitiveField();
+    Field<Result>& isf = sf.primitiveFieldRef();
+
+    parallel::parallelFor
+    (
+        mesh.nInternalFaces(),
+        [&](const label start, const label end)
+        {
+            for (label facei = start; facei < end; ++facei)
+            {
+                const Type& psiN = psi[neighbour[facei]];
+                isf[facei] = faceOp(facei, w[facei]*(psi[owner[facei]] - psiN) + psiN);
+            }
+        }
+    );
+
+    auto& bsf = sf.boundaryFieldRef();
+    forAll(bsf, patchi)
+    {
+        bsf[patchi] = patchOp(patchi, fvc::linearPatchValues(vf, patchi));
+    }
+
+    return tsf;
+}
+
+} // End anonymous namespace
+
+
+// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * //
+
+bool Foam::fvc::threaded::active()
+{
+    return parallel::numThreads() > 1;
+}
+
+
+template<class Type>
+Foam::tmp<Foam::GeometricField<Type, Foam::fvsPatchField, Foam::surfaceMesh>>
+Foam::fvc::threaded::interpolate
+(
+    const GeometricField<Type, fvPatchField, volMesh>& vf
+)
+{
+    const word name("interpolate(" + vf.name() + ')');
+
+    if (!active() || !fvc::schemeIs(vf.mesh().interpolationScheme(name), {"linear"}))
+    {
+        return Foam::fvc::interpolate(vf);
+    }
+
+    return linearFaceField<Type>
+    (
+        name,
+        vf.dimensions(),
+        vf,
+        [](const label, const Type& value){ return value; },
+        [](const label, tmp<Field<Type>>&& values){ return std::move(values); }
+    );
+}
+
+
+template<class Type>
+Foam::tmp<Foam::GeometricField<Type, Foam::fvPatchField, Foam::volMesh>>
+Foam::fvc::threaded::surfaceIntegrate
+(
+    const GeometricField<Type, fvsPatchField, surfaceMesh>& ssf
+)
+{
+    typedef GeometricField<Type, fvPatchField, volMesh> volFieldType;
+
+    if (!active())
+    {
+        return Foam::fvc::surfaceIntegrate(ssf);
+    }
+
+    tmp<volFieldType> tvf = volFieldType::New
+    (
+        "surfaceIntegrate(" + ssf.name() + ')',
+        ssf.mesh(),
+        dimensioned<Type>(ssf.dimensions()/dimVol, Zero),
+        extrapolatedCalculatedFvPatchField<Type>::typeName
+    );
+
+    integrate<false>(ssf, tvf.ref().primitiveFieldRef());
+    tvf.ref().correctBoundaryConditions();
+
+    return tvf;
+}
+
+
+template<class Type>
+Foam::tmp<Foam::GeometricField<Type, Foam::fvPatchField, Foam::volMesh>>
+Foam::fvc::threaded::surfaceSum
+(
+    const GeometricField<Type, fvsPatchField, surfaceMesh>& ssf
+)
+{
+    typedef GeometricField<Type, fvPatchField, volMesh> volFieldType;
+
+    if (!active())
+    {
+        return Foam::fvc::surfaceSum(ssf);
+    }
+
+    tmp<volFieldType> tvf = volFieldType::New
+    (
+        "surfaceSum(" + ssf.name() + ')',
+        ssf.mesh(),
+        dimensioned<Type>(ssf.dimensions(), Zero),
+        extrapolatedCalculatedFvPatchField<Type>::typeName
+    );
+
+    integrate<true>(ssf, tvf.ref().primitiveFieldRef());
+    tvf.ref().correctBoundaryConditions();
+
+    return tvf;
+}
+
+
+template<class Type>
+Foam::tmp<Foam::GeometricField<Type, Foam::fvPatchField, Foam::volMesh>>
+Foam::fvc::threaded::div
+(
+    const GeometricField<Type, fvsPatchField, surfaceMesh>& ssf
+)
+{
+    if (!active())
+    {
+        return Foam::fvc::div(ssf);
+    }
+
+    tmp<GeometricField<Type, fvPatchField, volMesh>> tdiv =
+        threaded::surfaceIntegrate(ssf);
+    tdiv.ref().rename("div(" + ssf.name() + ')');
+
+    return tdiv;
+}
+
+
+template<class Type>
+Foam::tmp
+<
+    Foam::GeometricField
+    <
+        typename Foam::innerProduct<Foam::vector, Type>::type,
+        Foam::fvPatchField,
+        Foam::volMesh
+    >
+>
+Foam::fvc::threaded::div
+(
+    const GeometricField<Type, fvPatchField, volMesh>& vf
+)
+{
+    typedef typename innerProduct<vector, Type>::type DivType;
+
+    const fvMesh& mesh = vf.mesh();
+    const word name("div(" + vf.name() + ')');
+
+    if (!active() || !fvc::schemeIs(mesh.divScheme(name), {"Gauss", "linear"}))
+    {
+        return Foam::fvc::div(vf);
+    }
+
+    // Gauss theorem with the linear interpolate of vf dotted with Sf
+    const vectorField& Sf = mesh.Sf().primitiveField();
+    const tmp<GeometricField<DivType, fvsPatchField, surfaceMesh>> tflux =
+        linearFaceField<DivType>
+        (
+            "dotInterpolate(" + vf.name() + ')',
+            vf.dimensions()*dimArea,
+            vf,
+            [&Sf](const label facei, const Type& value){ return Sf[facei] & value; },
+            [&mesh](const label patchi, tmp<Field<Type>>&& values)
+            {
+                return mesh.Sf().boundaryField()[patchi] & values;
+            }
+        );
+
+    tmp<GeometricField<DivType, fvPatchField, volMesh>> tdiv =
+        threaded::surfaceIntegrate(tflux());
+    tdiv.ref().rename(name);
+
+    return tdiv;
+}
+
+
+template<class Type>
+Foam::tmp<Foam::GeometricField<Type, Foam::fvPatchField, Foam::volMesh>>
+Foam::fvc::threaded::div
+(
+    const surfaceScalarField& flux,
+    const GeometricField<Type, fvPatchField, volMesh>& vf
+)
+{
+    const fvMesh& mesh = vf.mesh();
+
+    if
+    (
+        !active()
+     || !fvc::schemeIs
+        (
+            mesh.divScheme("div(" + flux.name() + ',' + vf.name() + ')'),
+            {"Gauss", "linear"}
+        )
+    )
+    {
+        return Foam::fvc::div(flux, vf);
+    }
+
+    // Convection term: flux times the linear interpolate of vf
+    const scalarField& iflux = flux.primitiveField();
+    const tmp<GeometricField<Type, fvsPatchField, surfaceMesh>> tfaceFlux =
+        linearFaceField<Type>
+        (
+            "flux(" + flux.name() + ',' + vf.name() + ')',
+            flux.dimensions()*vf.dimensions(),
+            vf,
+            [&iflux](const label facei, const Type& value){ return iflux[facei]*value; },
+            [&flux](const label patchi, tmp<Field<Type>>&& values)
+            {
+                return flux.boundaryField()[patchi]*values;
+            }
+        );
+
+    tmp<GeometricField<Type, fvPatchField, volMesh>> tconvection =
+        threaded::surfaceIntegrate(tfaceFlux());
+    tconvection.ref().rename
+    (
+        "convection(" + flux.name() + ',' + vf.name() + ')'
+    );
+
+    return tconvection;
+}
+
+
+// * * * * * * * * * * * * * Explicit Instantiations * * * * * * * * * * * * //
+
+namespace Foam
+{
+namespace fvc
+{
+namespace threaded
+{
+
+template
+tmp<surfaceScalarField> interpolate(const volScalarField&);
+
+template
+tmp<surfaceVectorField> interpolate(const volVectorField&);
+
+template
+tmp<surfaceSymmTensorField> interpolate(const volSymmTensorField&);
+
+template
+tmp<surfaceTensorField> interpolate(const volTensorField&);
+
+template
+tmp<volScalarField> surfaceIntegrate(const surfaceScalarField&);
+
+template
+tmp<volVectorField> surfaceIntegrate(const surfaceVectorField&);
+
+template
+tmp<volSymmTensorField> surfaceIntegrate(const surfaceSymmTensorField&);
+
+template
+tmp<volTensorField> surfaceIntegrate(const surfaceTensorField&);
+
+template
+tmp<volScalarField> surfaceSum(const surfaceScalarField&);
+
+template
+tmp<volVectorField> surfaceSum(const surfaceVectorField&);
+
+template
+tmp<volSymmTensorField> surfaceSum(const surfaceSymmTensorField&);
+
+template
+tmp<volTensorField> surfaceSum(const surfaceTensorField&);
+
+template
+tmp<volScalarField> div(const surfaceScalarField&);
+
+template
+tmp<volVectorField> div(const surfaceVectorField&);
+
+template
+tmp<volSymmTensorField> div(const surfaceSymmTensorField&);
+
+template
+tmp<volTensorField> div(const surfaceTensorField&);
+
+template
+tmp<volScalarField> div(const volVectorField&);
+
+template
+tmp<volVectorField> div(const volSymmTensorField&);
+
+template
+tmp<volVectorField> div(const volTensorField&);
+
+template
+tmp<volVectorField> div(const surfaceScalarField&, const volVectorField&);
+
+template
+tmp<volSymmTensorField> div(const surfaceScalarField&, const volSymmTensorField&);
+
+template
+tmp<volTensorField> div(const surfaceScalarField&, const volTensorField&);
+
+} // End namespace threaded
+} // End namespace fvc
+} // End namespace Foam
@@ -0,0 +1,91 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+InNamespace
+    Foam::fvc::threaded
+
+Description
+    Multithreaded versions of the face loops of fvc::interpolate, fvc::div
+    and fvc::surfaceSum, run on the thread pool of the fvc module.
+
+    The loops are partitioned over cells instead of faces: every cell
+    gathers the values of its owner faces (contiguous, ownerStartAddr)
+    and of its neighbour faces (losortAddr), so each thread writes only
+    its own cells and no atomics or face colouring are needed. Loops that
+    write one value per face (interpolate, the fluxes of div) are split
+    over faces. Boundary faces are added serially afterwards.
+
+    The threaded path is taken when the pool has more than one thread
+    (fvc.set_num_threads) and, for interpolate and div of volume fields,
+    when the fvSchemes entry is 'linear' or 'Gauss linear'. Otherwise the
+    corresponding OpenFOAM function is called. Results equal those of
+    OpenFOAM up to the summation order of the face contributions.
+
+SourceFiles
+    fvcThreaded.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_fvcThreaded
+#define foam_fvcThreaded
+
+#include "volFields.H"
+#include "surfaceFields.H"
+
+namespace Foam
+{
+namespace fvc
+{
+namespace threaded
+{
+
+//- True if the thread pool of the module has more than one thread
+bool active();
+
+template<class Type>
+tmp<GeometricField<Type, fvsPatchField, surfaceMesh>>
+interpolate(const GeometricField<Type, fvPatchField, volMesh>& vf);
+
+template<class Type>
+tmp<GeometricField<Type, fvPatchField, volMesh>>
+surfaceIntegrate(const GeometricField<Type, fvsPatchField, surfaceMesh>& ssf);
+
+template<class Type>
+tmp<GeometricField<Type, fvPatchField, volMesh>>
+surfaceSum(const GeometricField<Type, fvsPatchField, surfaceMesh>& ssf);
+
+template<class Type>
+tmp<GeometricField<Type, fvPatchField, volMesh>>
+div(const GeometricField<Type, fvsPatchField, surfaceMesh>& ssf);
+
+template<class Type>
+tmp<GeometricField<typename innerProduct<vector, Type>::type, fvPatchField, volMesh>>
+div(const GeometricField<Type, fvPatchField, volMesh>& vf);
+
+template<class Type>
+tmp<GeometricField<Type, fvPatchField, volMesh>>
+div
+(
+    const surfaceScalarField& flux,
+    const GeometricField<Type, fvPatchField, volMesh>& vf
+);
+
+} // End namespace threaded
+} // End namespace fvc
+} // End namespace Foam
+
+#endif
@@ -6,7 +6,7 @@ from typing import overload
 import pybFoam.pybFoam_core
 
 
-def generate_blockmesh(runtime: pybFoam.pybFoam_core.Time, blockmesh_dict: pybFoam.pybFoam_core.dictionary, verbose: bool = False, time_name: str = 'constant') -> pybFoam.pybFoam_core.fvMesh:
+def generate_blockmesh(runtime: pybFoam.pybFoam_core.Time, blockmesh_dict: pybFoam.pybFoam_core.dictionary, verbose: bool = False, time_name: str = 'constant', write: bool = True) -> pybFoam.pybFoam_core.fvMesh:
     """
     Generate a block mesh from dictionary and return fvMesh.
 
@@ -21,6 +21,10 @@ def generate_blockmesh(runtime: pybFoam.pybFoam_core.Time, blockmesh_dict: pybFo
         Enable OpenFOAM output messages (default: False).
     time_name : str, optional
         Time directory for mesh output (default: "constant").
+    write : bool, optional
+        Write the mesh to time_name and read it back as fvMesh
+        (default: True). With False the fvMesh is built in memory
+        from the generated polyMesh and nothing is written.
 
     Returns
     -------
@@ -19,6 +19,7 @@ License
 
 #include "bind_blockmesh.hpp"
 #include "mesh_utils.H"
+#include "inMemoryMesh.hpp"
 
 #include "IOdictionary.H"
 #include "blockMesh.H"
@@ -36,7 +37,8 @@ Foam::fvMesh* Foam::generateBlockMesh
     Time& runTime,
     const dictionary& blockMeshDict,
     bool verbose,
-    const std::string& timeName
+    const std::string& timeName,
+    bool write
 )
 {
     try
@@ -76,7 +78,7 @@ Foam::fvMesh* Foam::generateBlockMesh
 
         // Clean old mesh files
         fileName polyMeshPath = runTime.path()/word(timeName)/"polyMesh";
-        if (isDir(polyMeshPath))
+        if (write && isDir(polyMeshPath))
         {
             if (verbose)
             {
@@ -94,18 +96,47 @@ Foam::fvMesh* Foam::generateBlockMesh
             Info<< "Creating polyMesh from blockMesh" << nl << endl;
         }
 
+        // Not registered when kept in memory, the fvMesh takes the name
         autoPtr<polyMesh> meshPtr = blocks.mesh
         (
             IOobject
             (
                 "region0",
                 word(timeName),
-                runTime
+                runTime,
+                IOobject::NO_READ,
+                IOobject::NO_WRITE,
+                write ? IOobject::REGISTER : IOobject::NO_REGISTER
             )
         );
 
         polyMesh& mesh = meshPtr();
 
+        if (!write)
+        {
+            if (verbose)
+            {
+                Info<< "Instantiating fvMesh in memory" << nl << endl;
+            }
+
+            fvMesh* fvMeshPtr = newFvMesh
+            (
+                mesh,
+                IOobject
+                (
+                    "region0",
+                    word(timeName),
+                    runTime,
+                    IOobject::NO_READ,
+                    IOobject::NO_WRITE
+                )
+            );
+            meshPtr.clear();
+
+            MeshUtils::restoreOutput();
+            return fvMeshPtr;
+        }
+
         // Set precision for point data
         #if OPENFOAM >= 2406
             IOstream::minPrecision(10);
@@ -180,6 +211,7 @@ void Foam::addBlockMeshBindings(nb::module_& m)
         nb::arg("blockmesh_dict"),
         nb::arg("verbose") = false,
         nb::arg("time_name") = "constant",
+        nb::arg("write") = true,
         nb::rv_policy::take_ownership,
         R"pbdoc(
             Generate a block mesh from dictionary and return fvMesh.
@@ -195,6 +227,10 @@ void Foam::addBlockMeshBindings(nb::module_& m)
                 Enable OpenFOAM output messages (default: False).
             time_name : str, optional
                 Time directory for mesh output (default: "constant").
+            write : bool, optional
+                Write the mesh to time_name and read it back as fvMesh
+                (default: True). With False the fvMesh is built in memory
+                from the generated polyMesh and nothing is written.
 
             Returns
             -------
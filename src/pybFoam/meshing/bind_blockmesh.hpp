@@ -45,7 +45,8 @@ fvMesh* generateBlockMesh
     Time& runTime,
     const dictionary& blockMeshDict,
     bool verbose = false,
-    const std::string& timeName = "constant"
+    const std::string& timeName = "constant",
+    bool write = true
 );
 
 //- Add Python bindings for blockMesh functions
@@ -1,7 +1,7 @@
 """python bindings for openfoam"""
 
 import typing
-from collections.abc import Iterator, Sequence
+from collections.abc import Callable, Iterator, Sequence
 import enum
 from typing import Annotated, overload
 
@@ -227,6 +227,20 @@ class polyMesh:
         Create polyMesh from cellShapes (handles face orientation automatically)
         """
 
+    @overload
+    def __init__(self, io: IOobject, points: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], faceOffsets: Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)], facePoints: Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)], owner: Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)], neighbour: Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)], syncPar: bool = True) -> None:
+        """
+        Create polyMesh from an (N, 3) points array, CSR faces
+        (faceOffsets, facePoints) and owner/neighbour arrays
+        """
+
+    @overload
+    def __init__(self, io: IOobject, points: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], cells: Sequence[tuple[str, Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)]]], boundaryPatches: Sequence[tuple[str, Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)], Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)]]], defaultPatchName: str = 'defaultFaces', syncPar: bool = True) -> None:
+        """
+        Create polyMesh from an (N, 3) points array, (type, (nCells, nNodes)
+        array) cell blocks and (name, faceOffsets, facePoints) patches
+        """
+
     def write(self) -> bool: ...
 
     def nCells(self) -> int: ...
@@ -240,6 +254,7 @@ class polyMesh:
     def facesInstance(self) -> fileName: ...
 
     @property
+
     def meshSubDir(self) -> Word: ...
 
     def boundaryMesh(self) -> polyBoundaryMesh: ...
@@ -257,6 +272,27 @@ class polyMesh:
 
     def addPatches(self, patches: Sequence[polyPatch], validBoundary: bool = True) -> None: ...
 
+    def pointsArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Point coordinates (nPoints, 3), read-only view of the mesh points"""
+
+    def ownerArray(self) -> Annotated[NDArray[numpy.int32], dict(writable=False)]:
+        """Owner cell of every face, read-only view"""
+
+    def neighbourArray(self) -> Annotated[NDArray[numpy.int32], dict(writable=False)]:
+        """Neighbour cell of every internal face, read-only view"""
+
+    def facesCSR(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """
+        (offsets, pointLabels) of the faces, face i is
+        pointLabels[offsets[i]:offsets[i + 1]]
+        """
+
+    def cellsCSR(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """
+        (offsets, faceLabels) of the cells, cell i is
+        faceLabels[offsets[i]:offsets[i + 1]]
+        """
+
 class polyBoundaryMesh:
     def size(self) -> int: ...
 
@@ -306,8 +342,9 @@ class fvMesh:
     def __init__(self, time: Time, autoWrite: bool = False) -> None: ...
 
     @staticmethod
+
     def fromPolyMesh(polyMesh: polyMesh, autoWrite: bool = False) -> fvMesh:
-        """Create fvMesh from polyMesh by writing to disk and reading back"""
+        """Create fvMesh from polyMesh in memory, written only with autoWrite"""
 
     def nCells(self) -> int: ...
 
@@ -340,6 +377,27 @@ class fvMesh:
 
     def changing(self) -> bool: ...
 
+    def pointsArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Point coordinates (nPoints, 3), read-only view of the mesh points"""
+
+    def ownerArray(self) -> Annotated[NDArray[numpy.int32], dict(writable=False)]:
+        """Owner cell of every face, read-only view"""
+
+    def neighbourArray(self) -> Annotated[NDArray[numpy.int32], dict(writable=False)]:
+        """Neighbour cell of every internal face, read-only view"""
+
+    def facesCSR(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """
+        (offsets, pointLabels) of the faces, face i is
+        pointLabels[offsets[i]:offsets[i + 1]]
+        """
+
+    def cellsCSR(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """
+        (offsets, faceLabels) of the cells, cell i is
+        faceLabels[offsets[i]:offsets[i + 1]]
+        """
+
 class dynamicFvMesh(fvMesh):
     @staticmethod
     def New(arg0: argList, arg1: Time, /) -> dynamicFvMesh: ...
@@ -350,6 +408,41 @@ class dynamicFvMesh(fvMesh):
 
     def dynamic(self) -> bool: ...
 
+class fvMeshSubset:
+    @overload
+    def __init__(self, mesh: fvMesh, cells: Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)]) -> None:
+        """
+        Subset of the given cells; exposed internal faces form the
+        patch oldInternalFaces
+        """
+
+    @overload
+    def __init__(self, mesh: fvMesh, zone: str) -> None:
+        """Subset of the cells of a cellZone"""
+
+    def subMesh(self) -> fvMesh: ...
+
+    def baseMesh(self) -> fvMesh: ...
+
+    def cellMap(self) -> Annotated[NDArray[numpy.int32], dict(writable=False)]:
+        """Base mesh cell of every subset cell, read-only view"""
+
+    def faceMap(self) -> Annotated[NDArray[numpy.int32], dict(writable=False)]:
+        """Base mesh face of every subset face, read-only view"""
+
+    @overload
+    def interpolate(self, field: volScalarField) -> tmp_volScalarField:
+        """Copy of field on the subset mesh"""
+
+    @overload
+    def interpolate(self, field: volVectorField) -> tmp_volVectorField: ...
+
+    @overload
+    def interpolate(self, field: volSymmTensorField) -> tmp_volSymmTensorField: ...
+
+    @overload
+    def interpolate(self, field: volTensorField) -> tmp_volTensorField: ...
+
 class instant:
     def __str__(self) -> str: ...
 
@@ -798,6 +891,10 @@ class faceList:
     @overload
     def __init__(self, faces: Sequence[Sequence[int]]) -> None: ...
 
+    def __len__(self) -> int: ...
+
+    def __getitem__(self, arg: int, /) -> Annotated[NDArray[numpy.int32], dict(writable=False)]: ...
+
 class boolList:
     @overload
     def __init__(self, arg: boolList) -> None: ...
@@ -818,6 +915,13 @@ class boolList:
 
     def list(self) -> list[bool]: ...
 
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 class labelList:
     @overload
     def __init__(self, arg0: int, arg1: int, /) -> None: ...
@@ -838,6 +942,13 @@ class labelList:
 
     def list(self) -> list[int]: ...
 
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 class wordList:
     @overload
     def __init__(self, arg: wordList) -> None: ...
@@ -869,7 +980,10 @@ class scalarField:
     def __init__(self, arg: Sequence[float], /) -> None: ...
 
     @overload
-    def __init__(self, arg: Annotated[NDArray[numpy.float64], dict(device='cpu')], /) -> None: ...
+    def __init__(self, arg: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], /) -> None: ...
+
+    @overload
+    def __init__(self, arg: scalarFieldExpr, /) -> None: ...
 
     def __len__(self) -> int: ...
 
@@ -888,6 +1002,9 @@ class scalarField:
     @overload
     def __add__(self, arg: float, /) -> tmp_scalarField: ...
 
+    @overload
+    def __add__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
     @overload
     def __sub__(self, arg: scalarField, /) -> tmp_scalarField: ...
 
@@ -897,6 +1014,9 @@ class scalarField:
     @overload
     def __sub__(self, arg: float, /) -> tmp_scalarField: ...
 
+    @overload
+    def __sub__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
     @overload
     def __iadd__(self, arg: scalarField, /) -> scalarField: ...
 
@@ -906,6 +1026,9 @@ class scalarField:
     @overload
     def __iadd__(self, arg: float, /) -> scalarField: ...
 
+    @overload
+    def __iadd__(self, arg: scalarFieldExpr, /) -> scalarField: ...
+
     @overload
     def __isub__(self, arg: scalarField, /) -> scalarField: ...
 
@@ -915,6 +1038,9 @@ class scalarField:
     @overload
     def __isub__(self, arg: float, /) -> scalarField: ...
 
+    @overload
+    def __isub__(self, arg: scalarFieldExpr, /) -> scalarField: ...
+
     @overload
     def __mul__(self, arg: float, /) -> tmp_scalarField: ...
 
@@ -924,6 +1050,12 @@ class scalarField:
     @overload
     def __mul__(self, arg: tmp_scalarField, /) -> tmp_scalarField: ...
 
+    @overload
+    def __mul__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
     @overload
     def __truediv__(self, arg: float, /) -> tmp_scalarField: ...
 
@@ -933,8 +1065,27 @@ class scalarField:
     @overload
     def __truediv__(self, arg: tmp_scalarField, /) -> tmp_scalarField: ...
 
+    @overload
+    def __truediv__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
+    def copy_from(self, array: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Overwrite the values with a same-sized array using a single memcpy"""
+
     def __array__(self, dtype: object | None = None, copy: object | None = None) -> NDArray[numpy.float64]: ...
 
+    def expr(self) -> scalarFieldExpr:
+        """Lazy view of this field; operators on it build an expression"""
+
+    def assign(self, expr: scalarFieldExpr) -> None:
+        """Evaluate expr in a single pass into this field"""
+
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 class tmp_scalarField:
     def __call__(self) -> scalarField: ...
 
@@ -955,6 +1106,9 @@ class tmp_scalarField:
     @overload
     def __add__(self, arg: float, /) -> tmp_scalarField: ...
 
+    @overload
+    def __add__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
     @overload
     def __sub__(self, arg: scalarField, /) -> tmp_scalarField: ...
 
@@ -964,6 +1118,9 @@ class tmp_scalarField:
     @overload
     def __sub__(self, arg: float, /) -> tmp_scalarField: ...
 
+    @overload
+    def __sub__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
     @overload
     def __mul__(self, arg: float, /) -> tmp_scalarField: ...
 
@@ -973,6 +1130,12 @@ class tmp_scalarField:
     @overload
     def __mul__(self, arg: tmp_scalarField, /) -> tmp_scalarField: ...
 
+    @overload
+    def __mul__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
     def __rmul__(self, arg: float, /) -> tmp_scalarField: ...
 
     @overload
@@ -984,6 +1147,19 @@ class tmp_scalarField:
     @overload
     def __truediv__(self, arg: tmp_scalarField, /) -> tmp_scalarField: ...
 
+    @overload
+    def __truediv__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
+    def expr(self) -> scalarFieldExpr:
+        """Lazy view of this temporary; operators on it build an expression"""
+
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 class vectorField:
     @overload
     def __init__(self) -> None: ...
@@ -998,11 +1174,14 @@ class vectorField:
     def __init__(self, arg: Sequence[vector], /) -> None: ...
 
     @overload
-    def __init__(self, arg: Annotated[NDArray[numpy.float64], dict(device='cpu')], /) -> None: ...
+    def __init__(self, arg: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], /) -> None: ...
 
     @overload
     def __init__(self, arg: list[typing.Any], /) -> None: ...
 
+    @overload
+    def __init__(self, arg: vectorFieldExpr, /) -> None: ...
+
     def __len__(self) -> int: ...
 
     def __getitem__(self, arg: int, /) -> vector: ...
@@ -1020,6 +1199,9 @@ class vectorField:
     @overload
     def __add__(self, arg: vector, /) -> tmp_vectorField: ...
 
+    @overload
+    def __add__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
     @overload
     def __sub__(self, arg: vectorField, /) -> tmp_vectorField: ...
 
@@ -1029,6 +1211,9 @@ class vectorField:
     @overload
     def __sub__(self, arg: vector, /) -> tmp_vectorField: ...
 
+    @overload
+    def __sub__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
     @overload
     def __iadd__(self, arg: vectorField, /) -> vectorField: ...
 
@@ -1038,6 +1223,9 @@ class vectorField:
     @overload
     def __iadd__(self, arg: vector, /) -> vectorField: ...
 
+    @overload
+    def __iadd__(self, arg: vectorFieldExpr, /) -> vectorField: ...
+
     @overload
     def __isub__(self, arg: vectorField, /) -> vectorField: ...
 
@@ -1047,6 +1235,9 @@ class vectorField:
     @overload
     def __isub__(self, arg: vector, /) -> vectorField: ...
 
+    @overload
+    def __isub__(self, arg: vectorFieldExpr, /) -> vectorField: ...
+
     @overload
     def __mul__(self, arg: float, /) -> tmp_vectorField: ...
 
@@ -1056,6 +1247,9 @@ class vectorField:
     @overload
     def __mul__(self, arg: tmp_scalarField, /) -> tmp_vectorField: ...
 
+    @overload
+    def __mul__(self, arg: scalarFieldExpr, /) -> vectorFieldExpr: ...
+
     @overload
     def __truediv__(self, arg: float, /) -> tmp_vectorField: ...
 
@@ -1065,6 +1259,12 @@ class vectorField:
     @overload
     def __truediv__(self, arg: tmp_scalarField, /) -> tmp_vectorField: ...
 
+    @overload
+    def __truediv__(self, arg: scalarFieldExpr, /) -> vectorFieldExpr: ...
+
+    def copy_from(self, array: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Overwrite the values with a same-sized array using a single memcpy"""
+
     def __array__(self, dtype: object | None = None, copy: object | None = None) -> NDArray[numpy.float64]: ...
 
     @overload
@@ -1085,6 +1285,19 @@ class vectorField:
     @overload
     def __and__(self, arg: symmTensorField, /) -> tmp_vectorField: ...
 
+    def expr(self) -> vectorFieldExpr:
+        """Lazy view of this field; operators on it build an expression"""
+
+    def assign(self, expr: vectorFieldExpr) -> None:
+        """Evaluate expr in a single pass into this field"""
+
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 class tmp_vectorField:
     def __call__(self) -> vectorField: ...
 
@@ -1105,6 +1318,9 @@ class tmp_vectorField:
     @overload
     def __add__(self, arg: vector, /) -> tmp_vectorField: ...
 
+    @overload
+    def __add__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
     @overload
     def __sub__(self, arg: vectorField, /) -> tmp_vectorField: ...
 
@@ -1114,6 +1330,9 @@ class tmp_vectorField:
     @overload
     def __sub__(self, arg: vector, /) -> tmp_vectorField: ...
 
+    @overload
+    def __sub__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
     @overload
     def __mul__(self, arg: float, /) -> tmp_vectorField: ...
 
@@ -1123,6 +1342,9 @@ class tmp_vectorField:
     @overload
     def __mul__(self, arg: tmp_scalarField, /) -> tmp_vectorField: ...
 
+    @overload
+    def __mul__(self, arg: scalarFieldExpr, /) -> vectorFieldExpr: ...
+
     def __rmul__(self, arg: float, /) -> tmp_vectorField: ...
 
     @overload
@@ -1134,6 +1356,9 @@ class tmp_vectorField:
     @overload
     def __truediv__(self, arg: tmp_scalarField, /) -> tmp_vectorField: ...
 
+    @overload
+    def __truediv__(self, arg: scalarFieldExpr, /) -> vectorFieldExpr: ...
+
     @overload
     def __and__(self, arg: vector, /) -> tmp_scalarField: ...
 
@@ -1143,6 +1368,158 @@ class tmp_vectorField:
     @overload
     def __and__(self, arg: tmp_vectorField, /) -> tmp_scalarField: ...
 
+    def expr(self) -> vectorFieldExpr:
+        """Lazy view of this temporary; operators on it build an expression"""
+
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
+class scalarFieldExpr:
+    def __len__(self) -> int: ...
+
+    def __call__(self) -> scalarField:
+        """Evaluate the expression into a new field"""
+
+    def __neg__(self) -> scalarFieldExpr: ...
+
+    def __array__(self, dtype: object | None = None, copy: object | None = None) -> NDArray[numpy.float64]: ...
+
+    @overload
+    def __add__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __add__(self, arg: scalarField, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __add__(self, arg: tmp_scalarField, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __add__(self, arg: float, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __sub__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __sub__(self, arg: scalarField, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __sub__(self, arg: tmp_scalarField, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __sub__(self, arg: float, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: scalarField, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: tmp_scalarField, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: float, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: vectorField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: tmp_vectorField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: vector, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __truediv__(self, arg: scalarFieldExpr, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __truediv__(self, arg: scalarField, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __truediv__(self, arg: tmp_scalarField, /) -> scalarFieldExpr: ...
+
+    @overload
+    def __truediv__(self, arg: float, /) -> scalarFieldExpr: ...
+
+    def __radd__(self, arg: float, /) -> scalarFieldExpr: ...
+
+    def __rsub__(self, arg: float, /) -> scalarFieldExpr: ...
+
+    def __rmul__(self, arg: float, /) -> scalarFieldExpr: ...
+
+    def __rtruediv__(self, arg: float, /) -> scalarFieldExpr: ...
+
+class vectorFieldExpr:
+    def __len__(self) -> int: ...
+
+    def __call__(self) -> vectorField:
+        """Evaluate the expression into a new field"""
+
+    def __neg__(self) -> vectorFieldExpr: ...
+
+    def __array__(self, dtype: object | None = None, copy: object | None = None) -> NDArray[numpy.float64]: ...
+
+    @overload
+    def __add__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __add__(self, arg: vectorField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __add__(self, arg: tmp_vectorField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __add__(self, arg: vector, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __sub__(self, arg: vectorFieldExpr, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __sub__(self, arg: vectorField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __sub__(self, arg: tmp_vectorField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __sub__(self, arg: vector, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: scalarFieldExpr, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: scalarField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: tmp_scalarField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __mul__(self, arg: float, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __truediv__(self, arg: scalarFieldExpr, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __truediv__(self, arg: scalarField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __truediv__(self, arg: tmp_scalarField, /) -> vectorFieldExpr: ...
+
+    @overload
+    def __truediv__(self, arg: float, /) -> vectorFieldExpr: ...
+
+    def __radd__(self, arg: vector, /) -> vectorFieldExpr: ...
+
+    def __rsub__(self, arg: vector, /) -> vectorFieldExpr: ...
+
+    def __rmul__(self, arg: float, /) -> vectorFieldExpr: ...
+
 class tensorField:
     @overload
     def __init__(self) -> None: ...
@@ -1157,7 +1534,7 @@ class tensorField:
     def __init__(self, arg: Sequence[tensor], /) -> None: ...
 
     @overload
-    def __init__(self, arg: Annotated[NDArray[numpy.float64], dict(device='cpu')], /) -> None: ...
+    def __init__(self, arg: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], /) -> None: ...
 
     @overload
     def __init__(self, arg: list[typing.Any], /) -> None: ...
@@ -1224,8 +1601,18 @@ class tensorField:
     @overload
     def __truediv__(self, arg: tmp_scalarField, /) -> tmp_tensorField: ...
 
+    def copy_from(self, array: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Overwrite the values with a same-sized array using a single memcpy"""
+
     def __array__(self, dtype: object | None = None, copy: object | None = None) -> NDArray[numpy.float64]: ...
 
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 class tmp_tensorField:
     def __call__(self) -> tensorField: ...
 
@@ -1275,6 +1662,13 @@ class tmp_tensorField:
     @overload
     def __truediv__(self, arg: tmp_scalarField, /) -> tmp_tensorField: ...
 
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 class symmTensorField:
     @overload
     def __init__(self) -> None: ...
@@ -1289,7 +1683,7 @@ class symmTensorField:
     def __init__(self, arg: Sequence[symmTensor], /) -> None: ...
 
     @overload
-    def __init__(self, arg: Annotated[NDArray[numpy.float64], dict(device='cpu')], /) -> None: ...
+    def __init__(self, arg: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], /) -> None: ...
 
     @overload
     def __init__(self, arg: list[typing.Any], /) -> None: ...
@@ -1356,8 +1750,18 @@ class symmTensorField:
     @overload
     def __truediv__(self, arg: tmp_scalarField, /) -> tmp_symmTensorField: ...
 
+    def copy_from(self, array: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Overwrite the values with a same-sized array using a single memcpy"""
+
     def __array__(self, dtype: object | None = None, copy: object | None = None) -> NDArray[numpy.float64]: ...
 
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 class tmp_symmTensorField:
     def __call__(self) -> symmTensorField: ...
 
@@ -1407,6 +1811,13 @@ class tmp_symmTensorField:
     @overload
     def __truediv__(self, arg: tmp_scalarField, /) -> tmp_symmTensorField: ...
 
+    def __buffer__(self, flags: int, /) -> memoryview: ...
+
+    def __dlpack__(self, **kwargs: typing.Any) -> typing.Any:
+        """DLPack capsule sharing the memory of this object"""
+
+    def __dlpack_device__(self) -> tuple[int, int]: ...
+
 @overload
 def sum(arg: scalarField, /) -> float: ...
 
@@ -1535,12 +1946,15 @@ class volScalarField:
     def correctBoundaryConditions(self) -> None: ...
 
     @staticmethod
+
     def read_field(arg0: fvMesh, arg1: str, /) -> volScalarField: ...
 
     @staticmethod
+
     def from_registry(arg0: fvMesh, arg1: str, /) -> volScalarField: ...
 
     @staticmethod
+
     def list_objects(arg: fvMesh, /) -> wordList: ...
 
     def internalField(self) -> scalarField: ...
@@ -1631,6 +2045,18 @@ class volScalarField:
 
     def __rtruediv__(self, arg: float, /) -> tmp_volScalarField: ...
 
+    def patchIndex(self, name: str) -> int:
+        """Index of the patch in boundaryOffsets(); the lookup is cached on the mesh"""
+
+    def boundaryOffsets(self) -> NDArray[numpy.int32]:
+        """Start of each patch in boundaryArray(), followed by the total size"""
+
+    def boundaryArray(self) -> NDArray[numpy.float64]:
+        """Copy of all patch values as one array, patch after patch"""
+
+    def setBoundaryArray(self, values: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Assign all patch values from one array laid out like boundaryArray()"""
+
 @overload
 def write(arg: volScalarField, /) -> None: ...
 
@@ -1707,12 +2133,15 @@ class volVectorField:
     def correctBoundaryConditions(self) -> None: ...
 
     @staticmethod
+
     def read_field(arg0: fvMesh, arg1: str, /) -> volVectorField: ...
 
     @staticmethod
+
     def from_registry(arg0: fvMesh, arg1: str, /) -> volVectorField: ...
 
     @staticmethod
+
     def list_objects(arg: fvMesh, /) -> wordList: ...
 
     def internalField(self) -> vectorField: ...
@@ -1783,6 +2212,18 @@ class volVectorField:
 
     def mesh(self) -> fvMesh: ...
 
+    def patchIndex(self, name: str) -> int:
+        """Index of the patch in boundaryOffsets(); the lookup is cached on the mesh"""
+
+    def boundaryOffsets(self) -> NDArray[numpy.int32]:
+        """Start of each patch in boundaryArray(), followed by the total size"""
+
+    def boundaryArray(self) -> NDArray[numpy.float64]:
+        """Copy of all patch values as one array, patch after patch"""
+
+    def setBoundaryArray(self, values: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Assign all patch values from one array laid out like boundaryArray()"""
+
 class tmp_volTensorField:
     def __call__(self) -> volTensorField: ...
 
@@ -1835,12 +2276,15 @@ class volTensorField:
     def correctBoundaryConditions(self) -> None: ...
 
     @staticmethod
+
     def read_field(arg0: fvMesh, arg1: str, /) -> volTensorField: ...
 
     @staticmethod
+
     def from_registry(arg0: fvMesh, arg1: str, /) -> volTensorField: ...
 
     @staticmethod
+
     def list_objects(arg: fvMesh, /) -> wordList: ...
 
     def internalField(self) -> tensorField: ...
@@ -1911,6 +2355,18 @@ class volTensorField:
 
     def mesh(self) -> fvMesh: ...
 
+    def patchIndex(self, name: str) -> int:
+        """Index of the patch in boundaryOffsets(); the lookup is cached on the mesh"""
+
+    def boundaryOffsets(self) -> NDArray[numpy.int32]:
+        """Start of each patch in boundaryArray(), followed by the total size"""
+
+    def boundaryArray(self) -> NDArray[numpy.float64]:
+        """Copy of all patch values as one array, patch after patch"""
+
+    def setBoundaryArray(self, values: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Assign all patch values from one array laid out like boundaryArray()"""
+
 class tmp_volSymmTensorField:
     def __call__(self) -> volSymmTensorField: ...
 
@@ -1963,12 +2419,15 @@ class volSymmTensorField:
     def correctBoundaryConditions(self) -> None: ...
 
     @staticmethod
+
     def read_field(arg0: fvMesh, arg1: str, /) -> volSymmTensorField: ...
 
     @staticmethod
+
     def from_registry(arg0: fvMesh, arg1: str, /) -> volSymmTensorField: ...
 
     @staticmethod
+
     def list_objects(arg: fvMesh, /) -> wordList: ...
 
     def internalField(self) -> symmTensorField: ...
@@ -2039,6 +2498,18 @@ class volSymmTensorField:
 
     def mesh(self) -> fvMesh: ...
 
+    def patchIndex(self, name: str) -> int:
+        """Index of the patch in boundaryOffsets(); the lookup is cached on the mesh"""
+
+    def boundaryOffsets(self) -> NDArray[numpy.int32]:
+        """Start of each patch in boundaryArray(), followed by the total size"""
+
+    def boundaryArray(self) -> NDArray[numpy.float64]:
+        """Copy of all patch values as one array, patch after patch"""
+
+    def setBoundaryArray(self, values: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Assign all patch values from one array laid out like boundaryArray()"""
+
 class tmp_surfaceScalarField:
     def __call__(self) -> surfaceScalarField: ...
 
@@ -2101,12 +2572,15 @@ class surfaceScalarField:
     def correctBoundaryConditions(self) -> None: ...
 
     @staticmethod
+
     def read_field(arg0: fvMesh, arg1: str, /) -> surfaceScalarField: ...
 
     @staticmethod
+
     def from_registry(arg0: fvMesh, arg1: str, /) -> surfaceScalarField: ...
 
     @staticmethod
+
     def list_objects(arg: fvMesh, /) -> wordList: ...
 
     def internalField(self) -> scalarField: ...
@@ -2177,6 +2651,18 @@ class surfaceScalarField:
 
     def mesh(self) -> fvMesh: ...
 
+    def patchIndex(self, name: str) -> int:
+        """Index of the patch in boundaryOffsets(); the lookup is cached on the mesh"""
+
+    def boundaryOffsets(self) -> NDArray[numpy.int32]:
+        """Start of each patch in boundaryArray(), followed by the total size"""
+
+    def boundaryArray(self) -> NDArray[numpy.float64]:
+        """Copy of all patch values as one array, patch after patch"""
+
+    def setBoundaryArray(self, values: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Assign all patch values from one array laid out like boundaryArray()"""
+
 class tmp_surfaceVectorField:
     def __call__(self) -> surfaceVectorField: ...
 
@@ -2229,12 +2715,15 @@ class surfaceVectorField:
     def correctBoundaryConditions(self) -> None: ...
 
     @staticmethod
+
     def read_field(arg0: fvMesh, arg1: str, /) -> surfaceVectorField: ...
 
     @staticmethod
+
     def from_registry(arg0: fvMesh, arg1: str, /) -> surfaceVectorField: ...
 
     @staticmethod
+
     def list_objects(arg: fvMesh, /) -> wordList: ...
 
     def internalField(self) -> vectorField: ...
@@ -2305,6 +2794,18 @@ class surfaceVectorField:
 
     def mesh(self) -> fvMesh: ...
 
+    def patchIndex(self, name: str) -> int:
+        """Index of the patch in boundaryOffsets(); the lookup is cached on the mesh"""
+
+    def boundaryOffsets(self) -> NDArray[numpy.int32]:
+        """Start of each patch in boundaryArray(), followed by the total size"""
+
+    def boundaryArray(self) -> NDArray[numpy.float64]:
+        """Copy of all patch values as one array, patch after patch"""
+
+    def setBoundaryArray(self, values: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Assign all patch values from one array laid out like boundaryArray()"""
+
 class tmp_surfaceTensorField:
     def __call__(self) -> surfaceTensorField: ...
 
@@ -2357,12 +2858,15 @@ class surfaceTensorField:
     def correctBoundaryConditions(self) -> None: ...
 
     @staticmethod
+
     def read_field(arg0: fvMesh, arg1: str, /) -> surfaceTensorField: ...
 
     @staticmethod
+
     def from_registry(arg0: fvMesh, arg1: str, /) -> surfaceTensorField: ...
 
     @staticmethod
+
     def list_objects(arg: fvMesh, /) -> wordList: ...
 
     def internalField(self) -> tensorField: ...
@@ -2433,6 +2937,18 @@ class surfaceTensorField:
 
     def mesh(self) -> fvMesh: ...
 
+    def patchIndex(self, name: str) -> int:
+        """Index of the patch in boundaryOffsets(); the lookup is cached on the mesh"""
+
+    def boundaryOffsets(self) -> NDArray[numpy.int32]:
+        """Start of each patch in boundaryArray(), followed by the total size"""
+
+    def boundaryArray(self) -> NDArray[numpy.float64]:
+        """Copy of all patch values as one array, patch after patch"""
+
+    def setBoundaryArray(self, values: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Assign all patch values from one array laid out like boundaryArray()"""
+
 class tmp_surfaceSymmTensorField:
     def __call__(self) -> surfaceSymmTensorField: ...
 
@@ -2485,12 +3001,15 @@ class surfaceSymmTensorField:
     def correctBoundaryConditions(self) -> None: ...
 
     @staticmethod
+
     def read_field(arg0: fvMesh, arg1: str, /) -> surfaceSymmTensorField: ...
 
     @staticmethod
+
     def from_registry(arg0: fvMesh, arg1: str, /) -> surfaceSymmTensorField: ...
 
     @staticmethod
+
     def list_objects(arg: fvMesh, /) -> wordList: ...
 
     def internalField(self) -> symmTensorField: ...
@@ -2561,6 +3080,18 @@ class surfaceSymmTensorField:
 
     def mesh(self) -> fvMesh: ...
 
+    def patchIndex(self, name: str) -> int:
+        """Index of the patch in boundaryOffsets(); the lookup is cached on the mesh"""
+
+    def boundaryOffsets(self) -> NDArray[numpy.int32]:
+        """Start of each patch in boundaryArray(), followed by the total size"""
+
+    def boundaryArray(self) -> NDArray[numpy.float64]:
+        """Copy of all patch values as one array, patch after patch"""
+
+    def setBoundaryArray(self, values: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> None:
+        """Assign all patch values from one array laid out like boundaryArray()"""
+
 @overload
 def magSqr(arg: volScalarField, /) -> tmp_volScalarField: ...
 
@@ -2677,6 +3208,160 @@ def doubleInner(arg0: volTensorField, arg1: volSymmTensorField, /) -> tmp_volSca
 @overload
 def doubleInner(arg0: volTensorField, arg1: tmp_volSymmTensorField, /) -> tmp_volScalarField: ...
 
+@overload
+def domainIntegrate(field: volScalarField) -> float:
+    """Volume integral of the internal field over all processors"""
+
+@overload
+def domainIntegrate(field: volVectorField) -> vector: ...
+
+@overload
+def domainIntegrate(field: volSymmTensorField) -> symmTensor: ...
+
+@overload
+def domainIntegrate(field: volTensorField) -> tensor: ...
+
+@overload
+def domainIntegrate(field: tmp_volScalarField) -> float: ...
+
+@overload
+def domainIntegrate(field: tmp_volVectorField) -> vector: ...
+
+@overload
+def domainIntegrate(field: tmp_volSymmTensorField) -> symmTensor: ...
+
+@overload
+def domainIntegrate(field: tmp_volTensorField) -> tensor: ...
+
+@overload
+def weightedAverage(field: volScalarField) -> float:
+    """Volume weighted average of the internal field over all processors"""
+
+@overload
+def weightedAverage(field: volVectorField) -> vector: ...
+
+@overload
+def weightedAverage(field: volSymmTensorField) -> symmTensor: ...
+
+@overload
+def weightedAverage(field: volTensorField) -> tensor: ...
+
+@overload
+def weightedAverage(field: tmp_volScalarField) -> float: ...
+
+@overload
+def weightedAverage(field: tmp_volVectorField) -> vector: ...
+
+@overload
+def weightedAverage(field: tmp_volSymmTensorField) -> symmTensor: ...
+
+@overload
+def weightedAverage(field: tmp_volTensorField) -> tensor: ...
+
+@overload
+def cellZoneIntegrate(field: volScalarField, zone: str) -> float:
+    """Volume integral over the cells of a cellZone"""
+
+@overload
+def cellZoneIntegrate(field: volVectorField, zone: str) -> vector: ...
+
+@overload
+def cellZoneIntegrate(field: volSymmTensorField, zone: str) -> symmTensor: ...
+
+@overload
+def cellZoneIntegrate(field: volTensorField, zone: str) -> tensor: ...
+
+@overload
+def cellZoneAverage(field: volScalarField, zone: str) -> float:
+    """Volume weighted average over the cells of a cellZone"""
+
+@overload
+def cellZoneAverage(field: volVectorField, zone: str) -> vector: ...
+
+@overload
+def cellZoneAverage(field: volSymmTensorField, zone: str) -> symmTensor: ...
+
+@overload
+def cellZoneAverage(field: volTensorField, zone: str) -> tensor: ...
+
+@overload
+def patchIntegrate(field: volScalarField, patch: str) -> float:
+    """Area integral of the values on a non-processor patch"""
+
+@overload
+def patchIntegrate(field: volVectorField, patch: str) -> vector: ...
+
+@overload
+def patchIntegrate(field: volSymmTensorField, patch: str) -> symmTensor: ...
+
+@overload
+def patchIntegrate(field: volTensorField, patch: str) -> tensor: ...
+
+@overload
+def patchIntegrate(field: surfaceScalarField, patch: str) -> float: ...
+
+@overload
+def patchIntegrate(field: surfaceVectorField, patch: str) -> vector: ...
+
+@overload
+def patchIntegrate(field: surfaceSymmTensorField, patch: str) -> symmTensor: ...
+
+@overload
+def patchIntegrate(field: surfaceTensorField, patch: str) -> tensor: ...
+
+@overload
+def patchAverage(field: volScalarField, patch: str) -> float:
+    """Area weighted average of the values on a non-processor patch"""
+
+@overload
+def patchAverage(field: volVectorField, patch: str) -> vector: ...
+
+@overload
+def patchAverage(field: volSymmTensorField, patch: str) -> symmTensor: ...
+
+@overload
+def patchAverage(field: volTensorField, patch: str) -> tensor: ...
+
+@overload
+def patchAverage(field: surfaceScalarField, patch: str) -> float: ...
+
+@overload
+def patchAverage(field: surfaceVectorField, patch: str) -> vector: ...
+
+@overload
+def patchAverage(field: surfaceSymmTensorField, patch: str) -> symmTensor: ...
+
+@overload
+def patchAverage(field: surfaceTensorField, patch: str) -> tensor: ...
+
+@overload
+def patchIntegrals(field: volScalarField) -> dict[str, float]:
+    """
+    Area integrals of all non-processor patches from one reduction, keyed by
+    patch name
+    """
+
+@overload
+def patchIntegrals(field: volVectorField) -> dict[str, vector]: ...
+
+@overload
+def patchIntegrals(field: volSymmTensorField) -> dict[str, symmTensor]: ...
+
+@overload
+def patchIntegrals(field: volTensorField) -> dict[str, tensor]: ...
+
+@overload
+def patchIntegrals(field: surfaceScalarField) -> dict[str, float]: ...
+
+@overload
+def patchIntegrals(field: surfaceVectorField) -> dict[str, vector]: ...
+
+@overload
+def patchIntegrals(field: surfaceSymmTensorField) -> dict[str, symmTensor]: ...
+
+@overload
+def patchIntegrals(field: surfaceTensorField) -> dict[str, tensor]: ...
+
 class tmp_fvScalarMatrix:
     @overload
     def __add__(self, arg: tmp_fvScalarMatrix, /) -> tmp_fvScalarMatrix: ...
@@ -2747,6 +3432,62 @@ class fvScalarMatrix:
     @overload
     def __sub__(self, arg: tmp_volScalarField, /) -> tmp_fvScalarMatrix: ...
 
+    def diagArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Diagonal coefficients without boundary contributions, read-only view"""
+
+    def upperArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Coefficient (lowerAddr[f], upperAddr[f]) of every face, read-only view"""
+
+    def lowerArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """
+        Coefficient (upperAddr[f], lowerAddr[f]) of every face, read-only
+        view (the upper coefficients for a symmetric matrix)
+        """
+
+    def symmetric(self) -> bool:
+        """True if the matrix stores only the upper coefficients"""
+
+    def lduAddressing(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(lowerAddr, upperAddr): owner and neighbour cell of every face"""
+
+    def patchAddressing(self) -> list[Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """Face cells of every patch, one array per patch"""
+
+    def internalCoeffsArrays(self) -> list[Annotated[NDArray[numpy.float64], dict(writable=False)]]:
+        """Diagonal boundary coefficients, one read-only view per patch"""
+
+    def boundaryCoeffsArrays(self) -> list[Annotated[NDArray[numpy.float64], dict(writable=False)]]:
+        """
+        Source boundary coefficients (coupled patches: the coefficients of
+        the neighbour values), one read-only view per patch
+        """
+
+    def csrPattern(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(indptr, indices) of the matrix in CSR form, cached on the mesh"""
+
+    def csrValues(self, out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0, boundary: bool = True) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        Coefficients in the order of csrPattern, written into out if given.
+        With boundary the internalCoeffs (component cmpt) are added to the
+        diagonal; coupled patch coefficients are not included
+        """
+
+    def csrSource(self) -> NDArray[numpy.float64]:
+        """
+        Right-hand side: source plus the boundaryCoeffs of the uncoupled
+        patches, as a new array
+        """
+
+    def Amul(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        A @ x for component cmpt, written into out if given. Includes the
+        internalCoeffs and the coupled interfaces, as seen by the linear
+        solver; x may be an array or a scalarField
+        """
+
+    def residual(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """csrSource()[:, cmpt] - A @ x, written into out if given"""
+
 class tmp_fvVectorMatrix:
     @overload
     def __add__(self, arg: tmp_fvVectorMatrix, /) -> tmp_fvVectorMatrix: ...
@@ -2817,6 +3558,62 @@ class fvVectorMatrix:
     @overload
     def __sub__(self, arg: tmp_volVectorField, /) -> tmp_fvVectorMatrix: ...
 
+    def diagArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Diagonal coefficients without boundary contributions, read-only view"""
+
+    def upperArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Coefficient (lowerAddr[f], upperAddr[f]) of every face, read-only view"""
+
+    def lowerArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """
+        Coefficient (upperAddr[f], lowerAddr[f]) of every face, read-only
+        view (the upper coefficients for a symmetric matrix)
+        """
+
+    def symmetric(self) -> bool:
+        """True if the matrix stores only the upper coefficients"""
+
+    def lduAddressing(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(lowerAddr, upperAddr): owner and neighbour cell of every face"""
+
+    def patchAddressing(self) -> list[Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """Face cells of every patch, one array per patch"""
+
+    def internalCoeffsArrays(self) -> list[Annotated[NDArray[numpy.float64], dict(writable=False)]]:
+        """Diagonal boundary coefficients, one read-only view per patch"""
+
+    def boundaryCoeffsArrays(self) -> list[Annotated[NDArray[numpy.float64], dict(writable=False)]]:
+        """
+        Source boundary coefficients (coupled patches: the coefficients of
+        the neighbour values), one read-only view per patch
+        """
+
+    def csrPattern(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(indptr, indices) of the matrix in CSR form, cached on the mesh"""
+
+    def csrValues(self, out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0, boundary: bool = True) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        Coefficients in the order of csrPattern, written into out if given.
+        With boundary the internalCoeffs (component cmpt) are added to the
+        diagonal; coupled patch coefficients are not included
+        """
+
+    def csrSource(self) -> NDArray[numpy.float64]:
+        """
+        Right-hand side: source plus the boundaryCoeffs of the uncoupled
+        patches, as a new array
+        """
+
+    def Amul(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        A @ x for component cmpt, written into out if given. Includes the
+        internalCoeffs and the coupled interfaces, as seen by the linear
+        solver; x may be an array or a scalarField
+        """
+
+    def residual(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """csrSource()[:, cmpt] - A @ x, written into out if given"""
+
 class tmp_fvTensorMatrix:
     @overload
     def __add__(self, arg: tmp_fvTensorMatrix, /) -> tmp_fvTensorMatrix: ...
@@ -2887,6 +3684,62 @@ class fvTensorMatrix:
     @overload
     def __sub__(self, arg: tmp_volTensorField, /) -> tmp_fvTensorMatrix: ...
 
+    def diagArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Diagonal coefficients without boundary contributions, read-only view"""
+
+    def upperArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Coefficient (lowerAddr[f], upperAddr[f]) of every face, read-only view"""
+
+    def lowerArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """
+        Coefficient (upperAddr[f], lowerAddr[f]) of every face, read-only
+        view (the upper coefficients for a symmetric matrix)
+        """
+
+    def symmetric(self) -> bool:
+        """True if the matrix stores only the upper coefficients"""
+
+    def lduAddressing(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(lowerAddr, upperAddr): owner and neighbour cell of every face"""
+
+    def patchAddressing(self) -> list[Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """Face cells of every patch, one array per patch"""
+
+    def internalCoeffsArrays(self) -> list[Annotated[NDArray[numpy.float64], dict(writable=False)]]:
+        """Diagonal boundary coefficients, one read-only view per patch"""
+
+    def boundaryCoeffsArrays(self) -> list[Annotated[NDArray[numpy.float64], dict(writable=False)]]:
+        """
+        Source boundary coefficients (coupled patches: the coefficients of
+        the neighbour values), one read-only view per patch
+        """
+
+    def csrPattern(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(indptr, indices) of the matrix in CSR form, cached on the mesh"""
+
+    def csrValues(self, out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0, boundary: bool = True) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        Coefficients in the order of csrPattern, written into out if given.
+        With boundary the internalCoeffs (component cmpt) are added to the
+        diagonal; coupled patch coefficients are not included
+        """
+
+    def csrSource(self) -> NDArray[numpy.float64]:
+        """
+        Right-hand side: source plus the boundaryCoeffs of the uncoupled
+        patches, as a new array
+        """
+
+    def Amul(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        A @ x for component cmpt, written into out if given. Includes the
+        internalCoeffs and the coupled interfaces, as seen by the linear
+        solver; x may be an array or a scalarField
+        """
+
+    def residual(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """csrSource()[:, cmpt] - A @ x, written into out if given"""
+
 class tmp_fvSymmTensorMatrix:
     @overload
     def __add__(self, arg: tmp_fvSymmTensorMatrix, /) -> tmp_fvSymmTensorMatrix: ...
@@ -2957,6 +3810,62 @@ class fvSymmTensorMatrix:
     @overload
     def __sub__(self, arg: tmp_volSymmTensorField, /) -> tmp_fvSymmTensorMatrix: ...
 
+    def diagArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Diagonal coefficients without boundary contributions, read-only view"""
+
+    def upperArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Coefficient (lowerAddr[f], upperAddr[f]) of every face, read-only view"""
+
+    def lowerArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """
+        Coefficient (upperAddr[f], lowerAddr[f]) of every face, read-only
+        view (the upper coefficients for a symmetric matrix)
+        """
+
+    def symmetric(self) -> bool:
+        """True if the matrix stores only the upper coefficients"""
+
+    def lduAddressing(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(lowerAddr, upperAddr): owner and neighbour cell of every face"""
+
+    def patchAddressing(self) -> list[Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """Face cells of every patch, one array per patch"""
+
+    def internalCoeffsArrays(self) -> list[Annotated[NDArray[numpy.float64], dict(writable=False)]]:
+        """Diagonal boundary coefficients, one read-only view per patch"""
+
+    def boundaryCoeffsArrays(self) -> list[Annotated[NDArray[numpy.float64], dict(writable=False)]]:
+        """
+        Source boundary coefficients (coupled patches: the coefficients of
+        the neighbour values), one read-only view per patch
+        """
+
+    def csrPattern(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(indptr, indices) of the matrix in CSR form, cached on the mesh"""
+
+    def csrValues(self, out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0, boundary: bool = True) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        Coefficients in the order of csrPattern, written into out if given.
+        With boundary the internalCoeffs (component cmpt) are added to the
+        diagonal; coupled patch coefficients are not included
+        """
+
+    def csrSource(self) -> NDArray[numpy.float64]:
+        """
+        Right-hand side: source plus the boundaryCoeffs of the uncoupled
+        patches, as a new array
+        """
+
+    def Amul(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        A @ x for component cmpt, written into out if given. Includes the
+        internalCoeffs and the coupled interfaces, as seen by the linear
+        solver; x may be an array or a scalarField
+        """
+
+    def residual(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None, cmpt: int = 0) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """csrSource()[:, cmpt] - A @ x, written into out if given"""
+
 class SolverScalarPerformance:
     def __init__(self) -> None: ...
 
@@ -3049,6 +3958,107 @@ def solve(arg: fvSymmTensorMatrix, /) -> SolverSymmTensorPerformance: ...
 @overload
 def solve(arg: tmp_fvSymmTensorMatrix, /) -> SolverSymmTensorPerformance: ...
 
+def solve_all(matrices: Sequence[fvScalarMatrix | fvVectorMatrix | fvSymmTensorMatrix | fvTensorMatrix | tmp_fvScalarMatrix | tmp_fvVectorMatrix | tmp_fvSymmTensorMatrix | tmp_fvTensorMatrix]) -> list[SolverScalarPerformance | SolverVectorPerformance | SolverSymmTensorPerformance | SolverTensorPerformance]:
+    """
+    Solve independent matrices, each for a different field, on the
+    thread pool (set_num_threads) with the GIL released. Components of
+    vector/tensor matrices are solved concurrently as well. Returns the
+    solver performances in the order of the matrices
+    """
+
+class solveTelemetry:
+    """
+    Recorder of the linear solves started from Python, see
+    pybFoam.telemetry
+    """
+
+    @staticmethod
+    def instance() -> solveTelemetry: ...
+
+    def enable(self, capacity: int = 65536) -> None:
+        """Start recording, keeping the latest capacity solves in memory"""
+
+    def disable(self) -> None: ...
+
+    def enabled(self) -> bool: ...
+
+    def clear(self) -> None:
+        """Forget the records in memory"""
+
+    def __len__(self) -> int: ...
+
+    def names(self) -> list[str]:
+        """Field and solver names, indexed by the field/solver columns"""
+
+    def arrays(self) -> dict[str, NDArray[typing.Any]]:
+        """Records in memory, oldest first, as a dict of NumPy columns"""
+
+    def open(self, path: str) -> None:
+        """Stream all further records to a binary file from a background thread"""
+
+    def flush(self) -> None:
+        """Wait until all records are written"""
+
+    def close(self) -> None:
+        """Write the pending records and close the file"""
+
+class pythonSolverSystem:
+    """Linear system passed to a solver registered with register_linear_solver"""
+
+    def fieldName(self) -> str: ...
+
+    def cmpt(self) -> int:
+        """Component being solved"""
+
+    def tolerance(self) -> float: ...
+
+    def relTol(self) -> float: ...
+
+    def maxIter(self) -> int: ...
+
+    def psi(self) -> NDArray[numpy.float64]:
+        """Solution, initial guess on entry; write the result into it"""
+
+    def source(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Right-hand side, read-only view"""
+
+    def diagArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Diagonal coefficients including the boundary contributions"""
+
+    def upperArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Coefficient (lowerAddr[f], upperAddr[f]) of every face"""
+
+    def lowerArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Coefficient (upperAddr[f], lowerAddr[f]) of every face"""
+
+    def lduAddressing(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(lowerAddr, upperAddr): owner and neighbour cell of every face"""
+
+    def csrPattern(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """(indptr, indices) of the matrix in CSR form, cached on the mesh"""
+
+    def csrValues(self, out: Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')] | None = None) -> Annotated[NDArray[numpy.float64], dict(shape=(None,), order='C', device='cpu')]:
+        """
+        Coefficients in the order of csrPattern (coupled interfaces not
+        included), written into out if given
+        """
+
+    def Amul(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> NDArray[numpy.float64]:
+        """A @ x including the coupled interfaces"""
+
+    def residual(self, x: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> NDArray[numpy.float64]:
+        """source - A @ x including the coupled interfaces"""
+
+def register_linear_solver(name: str, function: Callable[[pythonSolverSystem], int | None]) -> None:
+    """
+    Register function(system) as the linear solver selected in fvSolution
+    by 'solver python; callback <name>;'. It solves system.psi() in place
+    and may return the number of iterations
+    """
+
+def unregister_linear_solver(name: str) -> None:
+    """Remove a linear solver registered with register_linear_solver"""
+
 class pisoControl:
     def __init__(self, mesh: fvMesh, dictName: Word = ...) -> None: ...
 
@@ -3116,6 +4126,12 @@ def computeCFLNumber(arg: surfaceScalarField, /) -> tuple[float, float]: ...
 
 def computeContinuityErrors(phi: surfaceScalarField) -> tuple[float, float]: ...
 
+def computeFluxStatistics(phi: surfaceScalarField, Co: volScalarField | None = None) -> tuple[float, float, float, float]:
+    """
+    (maxCo, meanCo, localContErr, globalContErr) of phi in one pass
+    over the cells. If Co is given it receives the cell Courant numbers
+    """
+
 class wallDist:
     @staticmethod
     def New(mesh: fvMesh) -> wallDist: ...
@@ -3150,3 +4166,17 @@ class Pstream:
     @staticmethod
     def nProcs() -> int:
         """Return number of processes"""
+
+def set_num_threads(n: int) -> None:
+    """Set the number of threads of the field kernels in this module (n < 1: all cores)"""
+
+def get_num_threads() -> int:
+    """Number of threads of the field kernels in this module"""
+
+def simd_isa() -> str:
+    """Instruction set of the vector/tensor field kernels: scalar, avx2 or avx512"""
+
+def set_simd_isa(name: str) -> None:
+    """
+    Select the instruction set of the field kernels, limited to what the CPU supports; for benchmarking
+    """
@@ -0,0 +1,266 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+    Zero-copy export of contiguous lists (Field, tmp<Field>, labelList,
+    boolList) through the Python buffer protocol and DLPack.
+
+    A list of n elements with nComponents components is exported as an
+    array of shape (n,) or (n, nComponents) of its component type
+    (numpyView, numpyConstView for data that must not be modified, or
+    numpyArray for a list handed over to NumPy). The exporting object is
+    kept alive by the consumer, so a view of a tmp result stays valid after
+    the tmp goes out of scope in Python. Lists that a cache may replace or
+    delete independently of any Python object are held by a shared_ptr and
+    exported with numpyConstView(shared_ptr), the view sharing ownership.
+
+    The buffer protocol slots have to be passed when the class is created:
+
+        nb::class_<Field<Type>>
+        (
+            m, "scalarField", nb::type_slots(arrayExport::slots<Field<Type>>)
+        );
+        arrayExport::addDLPack(cls);
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_arrayExport
+#define foam_arrayExport
+
+#include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "Field.H"
+#include "tmp.H"
+#include "pTraits.H"
+
+namespace nb = nanobind;
+
+namespace Foam
+{
+namespace arrayExport
+{
+
+//- The list holding the data of an exported object
+template<class Type>
+UList<Type>& storage(UList<Type>& list)
+{
+    return list;
+}
+
+//- Like Field.__array__ the view is writable, also for a tmp wrapping a
+//  const reference
+template<class Type>
+UList<Type>& storage(tmp<Field<Type>>& tfld)
+{
+    return const_cast<Field<Type>&>(tfld.cref());
+}
+
+
+//- Element type of the list held by Container
+template<class Container>
+using valueType = typename std::remove_reference_t
+<
+    decltype(storage(std::declval<Container&>()))
+>::value_type;
+
+
+//- struct module format character of a component type
+template<class Cmpt>
+constexpr const char* format()
+{
+    if constexpr (std::is_same<Cmpt, bool>::value) return "?";
+    else if constexpr (std::is_same<Cmpt, double>::value) return "d";
+    else if constexpr (std::is_same<Cmpt, float>::value) return "f";
+    else if constexpr (std::is_same<Cmpt, int32_t>::value) return "i";
+    else
+    {
+        static_assert(std::is_same<Cmpt, int64_t>::value, "Unsupported type");
+        return "q";
+    }
+}
+
+
+//- NumPy array sharing the storage of list, kept alive through owner
+template<class Type>
+nb::ndarray<nb::numpy, typename pTraits<Type>::cmptType>
+numpyView(UList<Type>& list, nb::handle owner)
+{
+    using Cmpt = typename pTraits<Type>::cmptType;
+    constexpr size_t nCmpt = pTraits<Type>::nComponents;
+
+    const size_t shape[2] = {size_t(list.size()), nCmpt};
+    return nb::ndarray<nb::numpy, Cmpt>
+    (
+        reinterpret_cast<Cmpt*>(list.data()),
+        nCmpt == 1 ? 1 : 2,
+        shape,
+        owner
+    );
+}
+
+
+//- Read-only NumPy array sharing the storage of list
+template<class Type>
+nb::ndarray<nb::numpy, const typename pTraits<Type>::cmptType>
+numpyConstView(const UList<Type>& list, nb::handle owner)
+{
+    using Cmpt = typename pTraits<Type>::cmptType;
+    constexpr size_t nCmpt = pTraits<Type>::nComponents;
+
+    const size_t shape[2] = {size_t(list.size()), nCmpt};
+    return nb::ndarray<nb::numpy, const Cmpt>
+    (
+        reinterpret_cast<const Cmpt*>(list.cdata()),
+        nCmpt == 1 ? 1 : 2,
+        shape,
+        owner
+    );
+}
+
+
+//- Read-only NumPy array sharing the ownership of list, so it stays valid
+//  after the holder has replaced or dropped the list
+template<class Type>
+nb::ndarray<nb::numpy, const typename pTraits<Type>::cmptType>
+numpyConstView(std::shared_ptr<const List<Type>> list)
+{
+    typedef std::shared_ptr<const List<Type>> holder;
+
+    holder* owned = new holder(std::move(list));
+    nb::capsule owner(owned, [](void* p) noexcept {
+        delete static_cast<holder*>(p);
+    });
+    return numpyConstView(**owned, owner);
+}
+
+
+//- NumPy array taking over the storage of list
+template<class Type>
+nb::ndarray<nb::numpy, typename pTraits<Type>::cmptType>
+numpyArray(List<Type>&& list)
+{
+    List<Type>* owned = new List<Type>(std::move(list));
+    nb::capsule owner(owned, [](void* p) noexcept {
+        delete static_cast<List<Type>*>(p);
+    });
+    return numpyView(*owned, owner);
+}
+
+
+//- Py_bf_getbuffer slot
+template<class Container>
+int getBuffer(PyObject* self, Py_buffer* view, int flags)
+{
+    using Type = valueType<Container>;
+    using Cmpt = typename pTraits<Type>::cmptType;
+    constexpr Py_ssize_t nCmpt = pTraits<Type>::nComponents;
+
+    UList<Type>* list = nullptr;
+    try
+    {
+        list = &storage(*nb::inst_ptr<Container>(self));
+    }
+    catch (const std::exception& e)
+    {
+        PyErr_SetString(PyExc_BufferError, e.what());
+        return -1;
+    }
+
+    // shape and strides, freed by releaseBuffer
+    Py_ssize_t* dims =
+        static_cast<Py_ssize_t*>(PyMem_Malloc(4*sizeof(Py_ssize_t)));
+    if (!dims)
+    {
+        PyErr_NoMemory();
+        return -1;
+    }
+    dims[0] = list->size();
+    dims[1] = nCmpt;
+    dims[2] = nCmpt*sizeof(Cmpt);
+    dims[3] = sizeof(Cmpt);
+
+    view->buf = list->data();
+    view->obj = self;
+    Py_INCREF(self);
+    view->len = dims[0]*nCmpt*sizeof(Cmpt);
+    view->readonly = 0;
+    view->itemsize = sizeof(Cmpt);
+    view->format =
+        (flags & PyBUF_FORMAT) ? const_cast<char*>(format<Cmpt>()) : nullptr;
+    view->ndim = nCmpt == 1 ? 1 : 2;
+    view->shape = (flags & PyBUF_ND) ? dims : nullptr;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? dims + 2 : nullptr;
+    view->suboffsets = nullptr;
+    view->internal = dims;
+    return 0;
+}
+
+
+//- Py_bf_releasebuffer slot
+inline void releaseBuffer(PyObject*, Py_buffer* view)
+{
+    PyMem_Free(view->internal);
+}
+
+
+//- Type slots enabling the buffer protocol for Container
+template<class Container>
+PyType_Slot slots[] =
+{
+    {Py_bf_getbuffer, reinterpret_cast<void*>(getBuffer<Container>)},
+    {Py_bf_releasebuffer, reinterpret_cast<void*>(releaseBuffer)},
+    {0, nullptr}
+};
+
+
+//- Add __dlpack__ and __dlpack_device__. The capsule is produced by a
+//  NumPy view, keyword arguments (stream, max_version, ...) are forwarded.
+template<class Container, class... Extra>
+void addDLPack(nb::class_<Container, Extra...>& cls)
+{
+    cls.def
+    (
+        "__dlpack__",
+        [](nb::handle self, nb::kwargs kwargs)
+        {
+            Container& c = nb::cast<Container&>(self);
+            nb::object view = nb::cast(numpyView(storage(c), self));
+            return view.attr("__dlpack__")(**kwargs);
+        },
+        "DLPack capsule sharing the memory of this object"
+    )
+    .def
+    (
+        "__dlpack_device__",
+        [](nb::handle)
+        {
+            return nb::make_tuple(1, 0);  // kDLCPU, device 0
+        }
+    );
+}
+
+} // End namespace arrayExport
+} // End namespace Foam
+
+#endif
@@ -0,0 +1,365 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::asyncBinaryWriter
+
+Description
+    Binary file appended by a background thread, shared by solveTelemetry
+    and probeStream.
+
+    The owner keeps the data to write and implements source. The writer
+    thread wakes up when a block is ready or a flush is requested, takes
+    the block with the lock held and writes it without the lock. A write
+    error stops the thread; it is rethrown by flush() and close() and
+    stays set until the next open().
+
+    Header-only since the extension modules do not share translation
+    units. Declare the writer as the last member of its owner so that
+    it is closed before the data of the source is destroyed.
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_asyncBinaryWriter
+#define foam_asyncBinaryWriter
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace Foam
+{
+
+class asyncBinaryWriter
+{
+public:
+
+    //- Data handed to the writer thread, called with the lock held
+    //  except writeBlock()
+    class source
+    {
+    public:
+
+        virtual ~source() = default;
+
+        //- A block is due without a flush
+        virtual bool blockReady() const = 0;
+
+        //- Take the data of the next block
+        virtual void takeBlock() = 0;
+
+        //- Write the taken block
+        virtual void writeBlock(std::ostream& os) = 0;
+
+        //- The taken block is written
+        virtual void blockWritten()
+        {}
+
+        //- Data left to take
+        virtual bool pending() const = 0;
+    };
+
+
+private:
+
+    // Private Data
+
+        source& source_;
+
+        //- Prefix of the error messages
+        const std::string name_;
+
+        mutable std::mutex mutex_;
+
+        std::ofstream file_;
+        std::thread writer_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        bool flushRequested_;
+        bool stop_;
+        std::exception_ptr error_;
+
+
+    // Private Member Functions
+
+        void writerLoop()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (true)
+            {
+                wake_.wait
+                (
+                    lock,
+                    [&]
+                    {
+                        return
+                            stop_ || flushRequested_ || source_.blockReady();
+                    }
+                );
+
+                const bool flushing = flushRequested_ || stop_;
+                const bool stopping = stop_;
+                source_.takeBlock();
+
+                lock.unlock();
+                try
+                {
+                    source_.writeBlock(file_);
+                    if (flushing)
+                    {
+                        file_.flush();
+                    }
+
+                    if (!file_)
+                    {
+                        throw std::runtime_error
+                        (
+                            name_ + ": writing to the file failed"
+                        );
+                    }
+                }
+                catch (...)
+                {
+                    lock.lock();
+                    error_ = std::current_exception();
+                    flushRequested_ = false;
+                    done_.notify_all();
+                    return;
+                }
+                lock.lock();
+
+                source_.blockWritten();
+
+                // Data added while writing is picked up by the next pass
+                const bool idle = !source_.pending();
+                if (flushing && idle)
+                {
+                    flushRequested_ = false;
+                }
+                done_.notify_all();
+
+                if (stopping && idle)
+                {
+                    return;
+                }
+            }
+        }
+
+        void rethrowError()
+        {
+            std::exception_ptr error;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                error = error_;
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+
+public:
+
+    // Constructors
+
+        asyncBinaryWriter(source& src, const std::string& name)
+        :
+            source_(src),
+            name_(name),
+            file_(),
+            writer_(),
+            flushRequested_(false),
+            stop_(false),
+            error_()
+        {}
+
+        asyncBinaryWriter(const asyncBinaryWriter&) = delete;
+        void operator=(const asyncBinaryWriter&) = delete;
+
+
+    //- Destructor, writes the pending data
+    ~asyncBinaryWriter()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+            // The error was reported by flush()/close() or is lost with
+            // the object
+        }
+    }
+
+
+    // Member Functions
+
+        //- Guards the data of the source
+        std::mutex& mutex() const noexcept
+        {
+            return mutex_;
+        }
+
+        bool isOpen() const noexcept
+        {
+            return writer_.joinable();
+        }
+
+        //- The writer thread stopped on an error, call with the lock held
+        bool failed() const noexcept
+        {
+            return bool(error_);
+        }
+
+        //- Wake the writer thread to check blockReady()
+        void notify()
+        {
+            wake_.notify_one();
+        }
+
+        //- Wait with the lock held until pred() holds after a written
+        //  block, rethrows the error of the writer thread
+        void wait
+        (
+            std::unique_lock<std::mutex>& lock,
+            const std::function<bool()>& pred
+        )
+        {
+            done_.wait(lock, [&]{ return pred() || error_; });
+            if (error_)
+            {
+                lock.unlock();
+                rethrowError();
+            }
+        }
+
+        //- Truncate path, write the header and start the writer thread.
+        //  Reset the source with the lock held before.
+        void open
+        (
+            const std::string& path,
+            const std::function<void(std::ostream&)>& writeHeader
+        )
+        {
+            if (writer_.joinable())
+            {
+                throw std::runtime_error(name_ + ": a file is already open");
+            }
+
+            file_.open(path, std::ios::binary | std::ios::trunc);
+            if (!file_)
+            {
+                file_.clear();
+                throw std::runtime_error
+                (
+                    name_ + ": cannot open '" + path + "'"
+                );
+            }
+
+            writeHeader(file_);
+            if (!file_)
+            {
+                file_.close();
+                file_.clear();
+                throw std::runtime_error
+                (
+                    name_ + ": cannot write the header of '" + path + "'"
+                );
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                flushRequested_ = false;
+                stop_ = false;
+                error_ = nullptr;
+            }
+
+            writer_ = std::thread(&asyncBinaryWriter::writerLoop, this);
+        }
+
+        //- Wait until all data is written
+        void flush()
+        {
+            if (!writer_.joinable())
+            {
+                return;
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (!error_)
+                {
+                    flushRequested_ = true;
+                    wake_.notify_one();
+                    done_.wait(lock, [&]{ return !flushRequested_ || error_; });
+                }
+            }
+            rethrowError();
+        }
+
+        //- Write the pending data and close the file
+        void close()
+        {
+            if (!writer_.joinable())
+            {
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            wake_.notify_one();
+            writer_.join();
+
+            file_.close();
+            stop_ = false;
+            rethrowError();
+        }
+};
+
+
+// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * * //
+
+inline void writeInt64(std::ostream& os, const int64_t value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+
+inline void writeDoubles(std::ostream& os, const double* data, const size_t n)
+{
+    os.write
+    (
+        reinterpret_cast<const char*>(data),
+        std::streamsize(n*sizeof(double))
+    );
+}
+
+} // End namespace Foam
+
+#endif
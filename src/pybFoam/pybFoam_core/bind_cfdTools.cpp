@@ -18,6 +18,7 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "bind_cfdTools.hpp"
+#include "fluxStatistics.hpp"
 
 #include "adjustPhi.H"
 #include "findRefCell.H"
@@ -34,25 +35,8 @@ namespace Foam
         const surfaceScalarField& phi
     )
     {
-        // Get the current time
-        const fvMesh& mesh = phi.mesh();
-        const Time& runTime = mesh.time();
-        scalar CoNum = 0.0;
-        scalar meanCoNum = 0.0;
-
-        {
-            scalarField sumPhi
-            (
-                fvc::surfaceSum(mag(phi))().primitiveField()
-            );
-
-            CoNum = 0.5*gMax(sumPhi/mesh.V().field())*runTime.deltaTValue();
-
-            meanCoNum =
-                0.5*(gSum(sumPhi)/gSum(mesh.V().field()))*runTime.deltaTValue();
-        }
-
-        return std::make_tuple(CoNum, meanCoNum);
+        const fluxStatistics stats(phi);
+        return std::make_tuple(stats.maxCo, stats.meanCo);
     }
 
     std::tuple <scalar, scalar> computeContinuityErrors
@@ -60,22 +44,34 @@ namespace Foam
         const surfaceScalarField& phi
     )
     {
-        // Get mesh and time
-        const fvMesh& mesh = phi.mesh();
-        const Time& runTime = mesh.time();
-
-        // Compute divergence of flux
-        volScalarField contErr(fvc::div(phi));
+        const fluxStatistics stats(phi);
+        return std::make_tuple(stats.localContErr, stats.globalContErr);
+    }
 
-        // Calculate local continuity error (absolute sum)
-        scalar sumLocalContErr = runTime.deltaTValue()*
-            mag(contErr)().weightedAverage(mesh.V()).value();
+    std::tuple <scalar, scalar, scalar, scalar> computeFluxStatistics
+    (
+        const surfaceScalarField& phi,
+        volScalarField* Co
+    )
+    {
+        const fluxStatistics stats
+        (
+            phi,
+            Co ? &Co->primitiveFieldRef() : nullptr
+        );
 
-        // Calculate global continuity error (signed)
-        scalar globalContErr = runTime.deltaTValue()*
-            contErr.weightedAverage(mesh.V()).value();
+        if (Co)
+        {
+            Co->correctBoundaryConditions();
+        }
 
-        return std::make_tuple(sumLocalContErr, globalContErr);
+        return std::make_tuple
+        (
+            stats.maxCo,
+            stats.meanCo,
+            stats.localContErr,
+            stats.globalContErr
+        );
     }
 
 
@@ -121,8 +117,15 @@ namespace Foam
             setRefCell(p, dict, pRefCell, pRefValue, forceReference);
             return std::make_tuple(pRefCell, pRefValue);
         }, nb::arg("p"), nb::arg("dict"), nb::arg("forceReference") = false);
-        m.def("computeCFLNumber", &computeCFLNumber);
-        m.def("computeContinuityErrors", &computeContinuityErrors, nb::arg("phi"));
+        m.def("computeCFLNumber", &computeCFLNumber,
+            nb::call_guard<nb::gil_scoped_release>());
+        m.def("computeContinuityErrors", &computeContinuityErrors, nb::arg("phi"),
+            nb::call_guard<nb::gil_scoped_release>());
+        m.def("computeFluxStatistics", &computeFluxStatistics,
+            nb::arg("phi"), nb::arg("Co").none() = nb::none(),
+            nb::call_guard<nb::gil_scoped_release>(),
+            "(maxCo, meanCo, localContErr, globalContErr) of phi in one pass\n"
+            "over the cells. If Co is given it receives the cell Courant numbers");
     }
 
 } // namespace Foam
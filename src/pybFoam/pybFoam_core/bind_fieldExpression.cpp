@@ -0,0 +1,208 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "bind_fieldExpression.hpp"
+#include "vector.H"
+
+namespace nb = nanobind;
+
+namespace Foam
+{
+
+// Register `name` for every operand form of Arg: expression, Field,
+// tmp<Field> and uniform value. The result expression references the
+// operand storage, hence keep the Python operands alive with it.
+template<class Type, class Arg, class Op>
+void defOperands(nb::class_<fieldExpression<Type>>& cls, const char* name, Op op)
+{
+    cls.def(name, [op](const fieldExpression<Type>& self, const fieldExpression<Arg>& rhs)
+    {
+        return op(self, rhs);
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>());
+    cls.def(name, [op](const fieldExpression<Type>& self, const Field<Arg>& rhs)
+    {
+        return op(self, fieldExpression<Arg>::field(rhs));
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>());
+    cls.def(name, [op](const fieldExpression<Type>& self, const tmp<Field<Arg>>& rhs)
+    {
+        return op(self, fieldExpression<Arg>::field(rhs()));
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>());
+    cls.def(name, [op](const fieldExpression<Type>& self, const Arg& rhs)
+    {
+        return op(self, fieldExpression<Arg>::uniform(rhs));
+    }, nb::keep_alive<0, 1>());
+}
+
+
+template<class Type>
+nb::class_<fieldExpression<Type>> declare_fieldExpression
+(
+    nb::module_& m,
+    nb::class_<Field<Type>>& fieldClass,
+    nb::class_<tmp<Field<Type>>>& tmpFieldClass,
+    const std::string& className
+)
+{
+    constexpr bool isScalar = std::is_same<Type, scalar>::value;
+    std::string exprClassName = className + "Expr";
+
+    const auto add = [](const auto& a, const auto& b) { return a + b; };
+    const auto subtract = [](const auto& a, const auto& b) { return a - b; };
+    const auto multiply = [](const auto& a, const auto& b) { return a*b; };
+    const auto divide = [](const auto& a, const auto& b) { return a/b; };
+
+    auto exprClass = nb::class_<fieldExpression<Type>>(m, exprClassName.c_str())
+    .def("__len__", [](const fieldExpression<Type>& self) {
+        return self.size();
+    })
+    .def("__call__", [](const fieldExpression<Type>& self) {
+        return self.evaluate();
+    }, "Evaluate the expression into a new field")
+    .def("__neg__", [](const fieldExpression<Type>& self) {
+        return -self;
+    }, nb::keep_alive<0, 1>())
+    .def("__array__", [](const fieldExpression<Type>& self, nb::object /*dtype*/, nb::object /*copy*/) {
+        constexpr size_t nComps = pTraits<Type>::nComponents;
+        Field<Type>* result = new Field<Type>(self.evaluate());
+        nb::capsule owner(result, [](void* p) noexcept {
+            delete static_cast<Field<Type>*>(p);
+        });
+        size_t shape[2] = {(size_t)result->size(), nComps};
+        return nb::ndarray<nb::numpy, scalar>
+        (
+            reinterpret_cast<scalar*>(result->data()),
+            isScalar ? 1 : 2,
+            shape,
+            owner
+        );
+    }, nb::arg("dtype") = nb::none(), nb::arg("copy") = nb::none())
+    ;
+
+    defOperands<Type, Type>(exprClass, "__add__", add);
+    defOperands<Type, Type>(exprClass, "__sub__", subtract);
+    defOperands<Type, scalar>(exprClass, "__mul__", multiply);
+    defOperands<Type, scalar>(exprClass, "__truediv__", divide);
+
+    // Reflected operators, reached for a uniform value on the left
+    exprClass
+    .def("__radd__", [](const fieldExpression<Type>& self, const Type& s) {
+        return fieldExpression<Type>::uniform(s) + self;
+    }, nb::keep_alive<0, 1>())
+    .def("__rsub__", [](const fieldExpression<Type>& self, const Type& s) {
+        return fieldExpression<Type>::uniform(s) - self;
+    }, nb::keep_alive<0, 1>())
+    .def("__rmul__", [](const fieldExpression<Type>& self, const scalar& s) {
+        return fieldExpression<scalar>::uniform(s)*self;
+    }, nb::keep_alive<0, 1>())
+    ;
+
+    if constexpr (isScalar)
+    {
+        defOperands<scalar, vector>(exprClass, "__mul__", multiply);
+
+        exprClass.def("__rtruediv__", [](const fieldExpression<scalar>& self, const scalar& s) {
+            return fieldExpression<scalar>::uniform(s)/self;
+        }, nb::keep_alive<0, 1>());
+    }
+
+    // Entry points from eager fields
+    fieldClass
+    .def("__init__", [](Field<Type>* self, const fieldExpression<Type>& e) {
+        new (self) Field<Type>(e.evaluate());
+    })
+    .def("expr", [](const Field<Type>& self) {
+        return fieldExpression<Type>::field(self);
+    }, nb::keep_alive<0, 1>(),
+        "Lazy view of this field; operators on it build an expression")
+    .def("assign", [](Field<Type>& self, const fieldExpression<Type>& e) {
+        e.evaluate(self);
+    }, nb::arg("expr"), "Evaluate expr in a single pass into this field")
+    .def("__add__", [](const Field<Type>& self, const fieldExpression<Type>& e) {
+        return fieldExpression<Type>::field(self) + e;
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>())
+    .def("__sub__", [](const Field<Type>& self, const fieldExpression<Type>& e) {
+        return fieldExpression<Type>::field(self) - e;
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>())
+    .def("__mul__", [](const Field<Type>& self, const fieldExpression<scalar>& e) {
+        return fieldExpression<Type>::field(self)*e;
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>())
+    .def("__truediv__", [](const Field<Type>& self, const fieldExpression<scalar>& e) {
+        return fieldExpression<Type>::field(self)/e;
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>())
+    .def("__iadd__", [](Field<Type>& self, const fieldExpression<Type>& e) -> Field<Type>& {
+        (fieldExpression<Type>::field(self) + e).evaluate(self);
+        return self;
+    }, nb::rv_policy::reference_internal)
+    .def("__isub__", [](Field<Type>& self, const fieldExpression<Type>& e) -> Field<Type>& {
+        (fieldExpression<Type>::field(self) - e).evaluate(self);
+        return self;
+    }, nb::rv_policy::reference_internal)
+    ;
+
+    tmpFieldClass
+    .def("expr", [](const tmp<Field<Type>>& self) {
+        return fieldExpression<Type>::field(self());
+    }, nb::keep_alive<0, 1>(),
+        "Lazy view of this temporary; operators on it build an expression")
+    .def("__add__", [](const tmp<Field<Type>>& self, const fieldExpression<Type>& e) {
+        return fieldExpression<Type>::field(self()) + e;
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>())
+    .def("__sub__", [](const tmp<Field<Type>>& self, const fieldExpression<Type>& e) {
+        return fieldExpression<Type>::field(self()) - e;
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>())
+    .def("__mul__", [](const tmp<Field<Type>>& self, const fieldExpression<scalar>& e) {
+        return fieldExpression<Type>::field(self())*e;
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>())
+    .def("__truediv__", [](const tmp<Field<Type>>& self, const fieldExpression<scalar>& e) {
+        return fieldExpression<Type>::field(self())/e;
+    }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>())
+    ;
+
+    if constexpr (isScalar)
+    {
+        fieldClass.def("__mul__", [](const Field<scalar>& self, const fieldExpression<vector>& e) {
+            return fieldExpression<scalar>::field(self)*e;
+        }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>());
+
+        tmpFieldClass.def("__mul__", [](const tmp<Field<scalar>>& self, const fieldExpression<vector>& e) {
+            return fieldExpression<scalar>::field(self())*e;
+        }, nb::keep_alive<0, 1>(), nb::keep_alive<0, 2>());
+    }
+
+    return exprClass;
+}
+
+
+template nb::class_<fieldExpression<scalar>> declare_fieldExpression<scalar>
+(
+    nb::module_&,
+    nb::class_<Field<scalar>>&,
+    nb::class_<tmp<Field<scalar>>>&,
+    const std::string&
+);
+
+template nb::class_<fieldExpression<vector>> declare_fieldExpression<vector>
+(
+    nb::module_&,
+    nb::class_<Field<vector>>&,
+    nb::class_<tmp<Field<vector>>>&,
+    const std::string&
+);
+
+} // End namespace Foam
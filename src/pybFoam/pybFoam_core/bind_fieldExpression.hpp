@@ -0,0 +1,53 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+    Python bindings for lazily evaluated field expressions
+    (scalarFieldExpr, vectorFieldExpr).
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_bind_fieldExpression
+#define foam_bind_fieldExpression
+
+// System includes
+#include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/ndarray.h>
+
+#include <string>
+
+#include "fieldExpression.hpp"
+#include "tmp.H"
+
+namespace nb = nanobind;
+
+namespace Foam
+{
+
+template<class Type>
+nb::class_<fieldExpression<Type>> declare_fieldExpression
+(
+    nb::module_& m,
+    nb::class_<Field<Type>>& fieldClass,
+    nb::class_<tmp<Field<Type>>>& tmpFieldClass,
+    const std::string& className
+);
+
+}
+
+#endif
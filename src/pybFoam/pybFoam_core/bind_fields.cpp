@@ -18,6 +18,9 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "bind_fields.hpp"
+#include "bind_fieldExpression.hpp"
+#include "fieldKernels.hpp"
+#include "arrayExport.hpp"
 #include "bind_primitives.hpp"
 #include "instantList.H"
 #include "uniformDimensionedFields.H"
@@ -34,13 +37,16 @@ namespace Foam
 template<class Type>
 Type declare_sum(const Field<Type>& values)
 {
-    return gSum(values);
+    return kernels::sum(values);
 }
 
 
 template<class Type>
 nb::class_< Field<Type>> declare_fields(nb::module_ &m, std::string className) {
-    auto fieldClass = nb::class_< Field<Type>>(m, className.c_str())
+    auto fieldClass = nb::class_< Field<Type>>
+    (
+        m, className.c_str(), nb::type_slots(arrayExport::slots<Field<Type>>)
+    )
     .def(nb::init<>())
     .def("__init__", [](Field<Type>* self, const Field<Type>& other) {
         new (self) Field<Type>(other);
@@ -55,39 +61,9 @@ nb::class_< Field<Type>> declare_fields(nb::module_ &m, std::string className) {
             (*self)[i] = vec[i];
         }
     })
-    .def("__init__", [](Field<Type>* self, nb::ndarray<nb::numpy, Foam::scalar, nb::device::cpu> arr) {
-        constexpr bool isScalar = std::is_same<Type, Foam::scalar>::value;
-        constexpr int nComps = isScalar ? 1 : Foam::pTraits<Type>::nComponents;
-
-        if (arr.ndim() != (size_t)(isScalar ? 1 : 2))
-            throw std::runtime_error(
-                "Expected " + std::to_string(isScalar ? 1 : 2) + "D array for this field type");
-
-        if (!isScalar && (int)arr.shape(1) != nComps)
-            throw std::runtime_error(
-                "Expected second dimension to be " + std::to_string(nComps)
-            );
-
-        size_t n = arr.shape(0);
-        const Foam::scalar* data = arr.data();
-
-        new (self) Foam::Field<Type>(n);
-
-        if constexpr (isScalar) {
-            for (size_t i = 0; i < n; ++i)
-            {
-                (*self)[i] = data[i];
-            }
-        }
-        else
-        {
-            for (size_t i = 0; i < n; ++i) {
-                Type val;
-                for (int j = 0; j < nComps; ++j)
-                    val[j] = data[i * nComps + j];
-                (*self)[i] = val;
-            }
-        }
+    .def("__init__", [](Field<Type>* self, const scalarArray& arr) {
+        new (self) Field<Type>(checkArrayShape<Type>(arr));
+        copyFromArray<Type>(*self, arr);
     })
     .def("__len__", [](const Field<Type>& self) {
         return self.size();
@@ -107,61 +83,73 @@ nb::class_< Field<Type>> declare_fields(nb::module_ &m, std::string className) {
         self[idx] = s;
     })
     .def("__add__", [](const Field<Type>& self, const Field<Type>& f) {
-        return self + f;
+        return kernels::binary<Type>(self, f, kernels::addOp());
     })
     .def("__add__", [](const Field<Type>& self, const tmp<Field<Type>>& f) {
-        return self + f();
+        return kernels::binary<Type>(self, f(), kernels::addOp());
+    })
+    .def("__add__", [](Field<Type>& self, const Type& s) {
+        return kernels::unary<Type>(self, [s](const Type& a) { return a + s; });
     })
-    .def("__add__", [](Field<Type>& self, const Type& s) {return self + s;})
     .def("__sub__", [](const Field<Type>& self, const Field<Type>& f) {
-        return self - f;
+        return kernels::binary<Type>(self, f, kernels::subtractOp());
     })
     .def("__sub__", [](const Field<Type>& self, const tmp<Field<Type>>& f) {
-        return self - f();
+        return kernels::binary<Type>(self, f(), kernels::subtractOp());
+    })
+    .def("__sub__", [](Field<Type>& self, const Type& s) {
+        return kernels::unary<Type>(self, [s](const Type& a) { return a - s; });
     })
-    .def("__sub__", [](Field<Type>& self, const Type& s) {return self - s;})
     .def("__iadd__", [](Field<Type>& self, const Field<Type>& f) -> Field<Type>& {
-        self += f;
+        kernels::inplace(self, f, kernels::addOp());
         return self;
     }, nb::rv_policy::reference_internal)
     .def("__iadd__", [](Field<Type>& self, const tmp<Field<Type>>& f) -> Field<Type>& {
-        self += f();
+        kernels::inplace(self, f(), kernels::addOp());
         return self;
     }, nb::rv_policy::reference_internal)
     .def("__iadd__", [](Field<Type>& self, const Type& s) -> Field<Type>& {
-        self += s;
+        kernels::inplace(self, [s](const Type& a) { return a + s; });
         return self;
     }, nb::rv_policy::reference_internal)
     .def("__isub__", [](Field<Type>& self, const Field<Type>& f) -> Field<Type>& {
-        self -= f;
+        kernels::inplace(self, f, kernels::subtractOp());
         return self;
     }, nb::rv_policy::reference_internal)
     .def("__isub__", [](Field<Type>& self, const tmp<Field<Type>>& f) -> Field<Type>& {
-        self -= f();
+        kernels::inplace(self, f(), kernels::subtractOp());
         return self;
     }, nb::rv_policy::reference_internal)
     .def("__isub__", [](Field<Type>& self, const Type& s) -> Field<Type>& {
-        self -= s;
+        kernels::inplace(self, [s](const Type& a) { return a - s; });
         return self;
     }, nb::rv_policy::reference_internal)
-    .def("__mul__", [](Field<Type>& self, const scalar& s) {return self * s;})
+    .def("__mul__", [](Field<Type>& self, const scalar& s) {
+        return kernels::unary<Type>(self, [s](const Type& a) { return a*s; });
+    })
     .def("__mul__", [](Foam::Field<Type>& self, const Field<scalar>& sf)
     {
-        return self * sf;
+        return kernels::binary<Type>(self, sf, kernels::multiplyOp());
     })
     .def("__mul__", [](Foam::Field<Type>& self, const tmp<Field<scalar>>& sf)
     {
-        return self * sf();
+        return kernels::binary<Type>(self, sf(), kernels::multiplyOp());
+    })
+    .def("__truediv__", [](Field<Type>& self, const scalar& s) {
+        return kernels::unary<Type>(self, [s](const Type& a) { return a/s; });
     })
-    .def("__truediv__", [](Field<Type>& self, const scalar& s) {return self / s;})
     .def("__truediv__", [](Field<Type>& self, const Field<scalar>& sf)
     {
-        return self / sf;
+        return kernels::binary<Type>(self, sf, kernels::divideOp());
     })
     .def("__truediv__", [](Field<Type>& self, const tmp<Field<scalar>>& sf)
     {
-        return self / sf();
+        return kernels::binary<Type>(self, sf(), kernels::divideOp());
     })
+    .def("copy_from", [](Field<Type>& self, const scalarArray& arr) {
+        copyFromArray<Type>(self, arr);
+    }, nb::arg("array"),
+        "Overwrite the values with a same-sized array using a single memcpy")
     .def("__array__", [](Field<Type>& self, nb::object /*dtype*/ = nb::none(), nb::object /*copy*/ = nb::none()) {
         if constexpr (std::is_same<Type, Foam::scalar>::value) {
             size_t shape[1] = {(size_t)self.size()};
@@ -191,6 +179,8 @@ nb::class_< Field<Type>> declare_fields(nb::module_ &m, std::string className) {
         });
     }
 
+    arrayExport::addDLPack(fieldClass);
+
     return fieldClass;
 }
 
@@ -198,7 +188,12 @@ template<class Type>
 nb::class_<tmp<Field<Type>>> declare_tmp_fields(nb::module_ &m, std::string className) {
     std::string tmp_className = "tmp_" + className;
 
-    auto tmpFieldClass = nb::class_<tmp<Field<Type>>>(m, tmp_className.c_str())
+    auto tmpFieldClass = nb::class_<tmp<Field<Type>>>
+    (
+        m,
+        tmp_className.c_str(),
+        nb::type_slots(arrayExport::slots<tmp<Field<Type>>>)
+    )
     .def("__call__",[](tmp<Field<Type>>& self) -> Field<Type>&
     {
         return self.ref();
@@ -221,45 +216,46 @@ nb::class_<tmp<Field<Type>>> declare_tmp_fields(nb::module_ &m, std::string clas
             self().begin(), self().end());
     }, nb::keep_alive<0, 1>())
     .def("__add__", [](const tmp<Field<Type>>& self, const Field<Type>& f) {
-        return self() + f;
+        return kernels::binary<Type>(self(), f, kernels::addOp());
     })
     .def("__add__", [](const tmp<Field<Type>>& self, const tmp<Field<Type>>& f) {
-        return self() + f();
+        return kernels::binary<Type>(self(), f(), kernels::addOp());
     })
     .def("__add__", [](const tmp<Field<Type>>& self, const Type& s) {
-        return self() + s;
+        return kernels::unary<Type>(self(), [s](const Type& a) { return a + s; });
     })
     .def("__sub__", [](const tmp<Field<Type>>& self, const Field<Type>& f) {
-        return self() - f;
+        return kernels::binary<Type>(self(), f, kernels::subtractOp());
     })
     .def("__sub__", [](const tmp<Field<Type>>& self, const tmp<Field<Type>>& f) {
-        return self() - f();
+        return kernels::binary<Type>(self(), f(), kernels::subtractOp());
     })
     .def("__sub__", [](const tmp<Field<Type>>& self, const Type& s) {
-        return self() - s;
+        return kernels::unary<Type>(self(), [s](const Type& a) { return a - s; });
     })
     .def("__mul__", [](const tmp<Field<Type>>& self, const scalar& s) {
-        return self() * s;
+        return kernels::unary<Type>(self(), [s](const Type& a) { return a*s; });
     })
     .def("__rmul__", [](const tmp<Field<Type>>& self, const scalar& s) {
-        return s * self();
+        return kernels::unary<Type>(self(), [s](const Type& a) { return s*a; });
     })
     .def("__mul__", [](const tmp<Field<Type>>& self, const Field<scalar>& sf) {
-        return self() * sf;
+        return kernels::binary<Type>(self(), sf, kernels::multiplyOp());
     })
     .def("__mul__", [](const tmp<Field<Type>>& self, const tmp<Field<scalar>>& sf) {
-        return self() * sf();
+        return kernels::binary<Type>(self(), sf(), kernels::multiplyOp());
     })
     .def("__truediv__", [](const tmp<Field<Type>>& self, const scalar& s) {
-        return self() / s;
+        return kernels::unary<Type>(self(), [s](const Type& a) { return a/s; });
     })
     .def("__truediv__", [](const tmp<Field<Type>>& self, const Field<scalar>& sf) {
-        return self() / sf;
+        return kernels::binary<Type>(self(), sf, kernels::divideOp());
     })
     .def("__truediv__", [](const tmp<Field<Type>>& self, const tmp<Field<scalar>>& sf) {
-        return self() / sf();
+        return kernels::binary<Type>(self(), sf(), kernels::divideOp());
     })
     ;
+    arrayExport::addDLPack(tmpFieldClass);
 
     return tmpFieldClass;
 }
@@ -297,10 +293,34 @@ void Foam::bindFields(nb::module_& m)
                     (*self)[i][j] = faces[i][j];
                 }
             }
-        }, nb::arg("faces"));
+        }, nb::arg("faces"))
+        .def("__len__", [](const faceList& self) {
+            return self.size();
+        })
+        // faces have different sizes and are not stored contiguously: each
+        // face is returned as a read-only array sharing its storage
+        .def("__getitem__", [](nb::handle self, label idx) {
+            const faceList& faces = nb::cast<const faceList&>(self);
+            if (idx < 0)
+            {
+                idx += faces.size();
+            }
+            if (idx < 0 || idx >= faces.size())
+            {
+                throw nb::index_error();
+            }
+            return arrayExport::numpyConstView
+            (
+                static_cast<const labelUList&>(faces[idx]),
+                self
+            );
+        });
 
 
-    nb::class_<List<bool>>(m, "boolList")
+    auto boolListClass = nb::class_<List<bool>>
+    (
+        m, "boolList", nb::type_slots(arrayExport::slots<List<bool>>)
+    )
         .def("__init__", [](List<bool>* self, const List<bool>& other) {
             new (self) List<bool>(other);
         })
@@ -346,8 +366,12 @@ void Foam::bindFields(nb::module_& m)
             return l_out;
         })
         ;
+    arrayExport::addDLPack(boolListClass);
 
-    nb::class_<List<label>>(m, "labelList")
+    auto labelListClass = nb::class_<List<label>>
+    (
+        m, "labelList", nb::type_slots(arrayExport::slots<List<label>>)
+    )
         .def(nb::init<label, label > ())
         .def("__init__", [](List<label>* self, const List<label>& other) {
             new (self) List<label>(other);
@@ -382,6 +406,7 @@ void Foam::bindFields(nb::module_& m)
             return l_out;
         })
         ;
+    arrayExport::addDLPack(labelListClass);
 
     nb::class_<List<word>>(m, "wordList")
         .def("__init__", [](List<word>* self, const List<word>& other) {
@@ -423,10 +448,17 @@ void Foam::bindFields(nb::module_& m)
     auto tmp_sf = declare_tmp_fields<scalar>(m, std::string("scalarField"));
 
     auto vf = declare_fields<vector>(m, std::string("vectorField"))
-    .def("__and__", [](Field<vector>& self, const vector& s) {return self & s;})
+    .def("__and__", [](Field<vector>& self, const vector& s)
+    {
+        return kernels::unary<scalar>
+        (
+            self,
+            kernels::uniformOp<kernels::innerOp, vector>{{}, s}
+        );
+    })
     .def("__and__", [](Field<vector>& self, const Field<vector>& sf)
     {
-        return self & sf;
+        return kernels::binary<scalar>(self, sf, kernels::innerOp());
     })
     .def("__and__", [](Field<vector>& self, const tensor& s) {return self & s;})
     .def("__and__", [](Field<vector>& self, const Field<tensor>& sf)
@@ -441,16 +473,24 @@ void Foam::bindFields(nb::module_& m)
     ;
     auto tmp_vf = declare_tmp_fields<vector>(m, std::string("vectorField"))
     .def("__and__", [](const tmp<Field<vector>>& self, const vector& s) {
-        return self() & s;
+        return kernels::unary<scalar>
+        (
+            self(),
+            kernels::uniformOp<kernels::innerOp, vector>{{}, s}
+        );
     })
     .def("__and__", [](const tmp<Field<vector>>& self, const Field<vector>& sf) {
-        return self() & sf;
+        return kernels::binary<scalar>(self(), sf, kernels::innerOp());
     })
     .def("__and__", [](const tmp<Field<vector>>& self, const tmp<Field<vector>>& sf) {
-        return self() & sf();
+        return kernels::binary<scalar>(self(), sf(), kernels::innerOp());
     })
     ;
 
+    // lazily evaluated expressions: a.expr()*b + c runs in a single pass
+    declare_fieldExpression<scalar>(m, sf, tmp_sf, std::string("scalarField"));
+    declare_fieldExpression<vector>(m, vf, tmp_vf, std::string("vectorField"));
+
 
     auto tf = declare_fields<tensor>(m, std::string("tensorField"))
     // .def("__iand__", [](Field<tensor>& self, const vector& s) {return Field<vector>(self & s);})
@@ -36,7 +36,10 @@ SourceFiles
 #include <nanobind/stl/string.h>
 #include <nanobind/make_iterator.h>
 
+#include <cstring>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 
 #include "Field.H"
 #include "scalar.H"
@@ -58,6 +61,56 @@ nb::ndarray<nb::numpy, scalar> toNumpy<scalar>(const Field<scalar>& values);
 template<class Type>
 Type declare_sum(const Field<Type>& values);
 
+
+// C-contiguous float64 buffer; other layouts and dtypes are converted by
+// nanobind before the call
+using scalarArray =
+    nb::ndarray<nb::numpy, const Foam::scalar, nb::c_contig, nb::device::cpu>;
+
+// C-contiguous label buffer (int32 or int64, matching the label size)
+using labelArray =
+    nb::ndarray<nb::numpy, const Foam::label, nb::c_contig, nb::device::cpu>;
+
+
+// Number of elements of a (N,) array for scalars or (N, nComps) otherwise
+template<class Type>
+label checkArrayShape(const scalarArray& arr)
+{
+    constexpr bool isScalar = std::is_same<Type, Foam::scalar>::value;
+    constexpr size_t nComps = Foam::pTraits<Type>::nComponents;
+
+    if (arr.ndim() != (size_t)(isScalar ? 1 : 2))
+        throw std::runtime_error(
+            "Expected " + std::to_string(isScalar ? 1 : 2) + "D array for this field type");
+
+    if (!isScalar && (size_t)arr.shape(1) != nComps)
+        throw std::runtime_error(
+            "Expected second dimension to be " + std::to_string(nComps)
+        );
+
+    return arr.shape(0);
+}
+
+
+// Bulk copy: Field<Type> stores its components contiguously, matching the
+// row-major layout of the array
+template<class Type>
+void copyFromArray(UList<Type>& field, const scalarArray& arr)
+{
+    const label n = checkArrayShape<Type>(arr);
+    if (n != field.size())
+        throw std::runtime_error(
+            "Array size " + std::to_string(n)
+          + " does not match field size " + std::to_string(field.size())
+        );
+
+    if (n > 0)
+    {
+        std::memcpy(field.data(), arr.data(), n*sizeof(Type));
+    }
+}
+
+
 template<typename Type>
 void fromNumpy(Field<Type>& values, nb::ndarray<nb::numpy, scalar, nb::ndim<1>> np_arr);
 
@@ -18,12 +18,369 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "bind_fvMatrix.hpp"
+#include "arrayExport.hpp"
+#include "bind_fields.hpp"
+#include "concurrentSolve.hpp"
+#include "lduCSRPattern.hpp"
+#include "pythonSolver.hpp"
+#include "solveTelemetry.hpp"
 #include "tmp.H"
 
+#include <nanobind/ndarray.h>
+#include <nanobind/stl/optional.h>
+#include <nanobind/stl/pair.h>
+#include <nanobind/stl/vector.h>
+
+#include <algorithm>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 
 namespace Foam
 {
 
+using scalarOutArray =
+    nb::ndarray<nb::numpy, scalar, nb::ndim<1>, nb::c_contig, nb::device::cpu>;
+
+//- Source with the boundaryCoeffs of the uncoupled patches added, the
+//  right-hand side solved for
+template<class Type>
+Field<Type> boundarySource(const fvMatrix<Type>& matrix)
+{
+    Field<Type> source(matrix.source());
+
+    forAll(matrix.psi().boundaryField(), patchi)
+    {
+        if (matrix.psi().boundaryField()[patchi].coupled())
+        {
+            continue;
+        }
+
+        const labelUList& faceCells = matrix.lduAddr().patchAddr(patchi);
+        const Field<Type>& coeffs = matrix.boundaryCoeffs()[patchi];
+        forAll(faceCells, i)
+        {
+            source[faceCells[i]] += coeffs[i];
+        }
+    }
+
+    return source;
+}
+
+//- Ax = A x for component cmpt as solved by fvMatrix::solveSegregated: the
+//  internalCoeffs are added to the diagonal and the coupled interfaces are
+//  updated from x. With residual, Ax is replaced by b - A x with b the
+//  source plus the boundaryCoeffs of the uncoupled patches.
+//  x is copied into per-thread work fields (reused between calls), so x and
+//  Ax may be the same buffer. The interface list and the component
+//  boundaryCoeffs are per-thread work lists too: once their sizes are
+//  reached, repeated calls do not allocate.
+template<class Type>
+void fvMatrixAmul
+(
+    const fvMatrix<Type>& matrix,
+    const scalarArray& x,
+    scalar* Ax,
+    const direction cmpt,
+    const bool residual
+)
+{
+    if (cmpt >= pTraits<Type>::nComponents)
+    {
+        throw std::runtime_error("component out of range");
+    }
+
+    thread_local scalarField xWork;
+    thread_local scalarField AxWork;
+
+    const label n = matrix.diag().size();
+    xWork.resize(n);
+    AxWork.resize(n);
+    copyFromArray(xWork, x);
+
+    const auto& bPsi = matrix.psi().boundaryField();
+
+    // As bPsi.scalarInterfaces(), refilled in place
+    thread_local lduInterfaceFieldPtrsList interfaces;
+    interfaces.resize(bPsi.size());
+    forAll(bPsi, patchi)
+    {
+        interfaces.set(patchi, isA<lduInterfaceField>(bPsi[patchi]));
+    }
+
+    if constexpr (std::is_same<Type, scalar>::value)
+    {
+        matrix.Amul(AxWork, tmp<scalarField>(xWork), matrix.boundaryCoeffs(), interfaces, cmpt);
+    }
+    else
+    {
+        // As boundaryCoeffs().component(cmpt), refilled in place
+        thread_local FieldField<Field, scalar> bouCmpt;
+        const FieldField<Field, Type>& bouCoeffs = matrix.boundaryCoeffs();
+        bouCmpt.resize(bouCoeffs.size());
+        forAll(bouCoeffs, patchi)
+        {
+            if (!bouCmpt.set(patchi))
+            {
+                bouCmpt.set(patchi, new scalarField());
+            }
+
+            scalarField& cmptCoeffs = bouCmpt[patchi];
+            cmptCoeffs.resize(bouCoeffs[patchi].size());
+            forAll(cmptCoeffs, facei)
+            {
+                cmptCoeffs[facei] = component(bouCoeffs[patchi][facei], cmpt);
+            }
+        }
+
+        matrix.Amul(AxWork, tmp<scalarField>(xWork), bouCmpt, interfaces, cmpt);
+    }
+
+    forAll(bPsi, patchi)
+    {
+        const labelUList& faceCells = matrix.lduAddr().patchAddr(patchi);
+        const Field<Type>& intCoeffs = matrix.internalCoeffs()[patchi];
+        forAll(faceCells, i)
+        {
+            AxWork[faceCells[i]] += component(intCoeffs[i], cmpt)*xWork[faceCells[i]];
+        }
+    }
+
+    if (!residual)
+    {
+        std::copy_n(AxWork.cdata(), n, Ax);
+        return;
+    }
+
+    const Field<Type>& source = matrix.source();
+    for (label celli = 0; celli < n; ++celli)
+    {
+        Ax[celli] = component(source[celli], cmpt) - AxWork[celli];
+    }
+
+    forAll(bPsi, patchi)
+    {
+        if (bPsi[patchi].coupled())
+        {
+            continue;
+        }
+
+        const labelUList& faceCells = matrix.lduAddr().patchAddr(patchi);
+        const Field<Type>& bouCoeffs = matrix.boundaryCoeffs()[patchi];
+        forAll(faceCells, i)
+        {
+            Ax[faceCells[i]] += component(bouCoeffs[i], cmpt);
+        }
+    }
+}
+
+//- out if given and of the right size, otherwise a new array of n entries.
+//  The out arguments are bound with noconvert(), so a float32 or strided
+//  array is rejected instead of being replaced by a temporary copy
+inline scalarOutArray outputArray(std::optional<scalarOutArray>& out, const label n)
+{
+    if (out)
+    {
+        if (label(out->shape(0)) != n)
+        {
+            throw std::runtime_error
+            (
+                "out has " + std::to_string(out->shape(0))
+              + " entries, expected " + std::to_string(n)
+            );
+        }
+        return *out;
+    }
+
+    scalar* data = new scalar[n];
+    nb::capsule owner(data, [](void* p) noexcept {
+        delete[] static_cast<scalar*>(p);
+    });
+    return scalarOutArray(data, {size_t(n)}, owner);
+}
+
+//- Read-only views of the patch coefficient fields
+template<class Type>
+std::vector<nb::ndarray<nb::numpy, const typename pTraits<Type>::cmptType>>
+patchCoeffViews(const FieldField<Field, Type>& coeffs, nb::handle owner)
+{
+    std::vector<nb::ndarray<nb::numpy, const typename pTraits<Type>::cmptType>>
+        views;
+    views.reserve(coeffs.size());
+    forAll(coeffs, patchi)
+    {
+        views.push_back(arrayExport::numpyConstView(coeffs[patchi], owner));
+    }
+    return views;
+}
+
+template<class Type>
+void bindLduArrays(nb::class_<fvMatrix<Type>>& cls)
+{
+    cls.def("diagArray",
+        [](nb::handle self)
+        {
+            const fvMatrix<Type>& matrix = nb::cast<const fvMatrix<Type>&>(self);
+            return arrayExport::numpyConstView(matrix.diag(), self);
+        },
+        "Diagonal coefficients without boundary contributions, read-only view")
+    .def("upperArray",
+        [](nb::handle self)
+        {
+            const fvMatrix<Type>& matrix = nb::cast<const fvMatrix<Type>&>(self);
+            if (!matrix.hasUpper() && !matrix.hasLower())
+            {
+                throw std::runtime_error("fvMatrix has no off-diagonal coefficients");
+            }
+            return arrayExport::numpyConstView(matrix.upper(), self);
+        },
+        "Coefficient (lowerAddr[f], upperAddr[f]) of every face, read-only view")
+    .def("lowerArray",
+        [](nb::handle self)
+        {
+            const fvMatrix<Type>& matrix = nb::cast<const fvMatrix<Type>&>(self);
+            if (!matrix.hasUpper() && !matrix.hasLower())
+            {
+                throw std::runtime_error("fvMatrix has no off-diagonal coefficients");
+            }
+            return arrayExport::numpyConstView(matrix.lower(), self);
+        },
+        "Coefficient (upperAddr[f], lowerAddr[f]) of every face, read-only\n"
+        "view (the upper coefficients for a symmetric matrix)")
+    .def("symmetric", &fvMatrix<Type>::symmetric,
+        "True if the matrix stores only the upper coefficients")
+    .def("lduAddressing",
+        [](nb::handle self)
+        {
+            const lduAddressing& addr =
+                nb::cast<const fvMatrix<Type>&>(self).lduAddr();
+            return std::make_pair
+            (
+                arrayExport::numpyConstView(addr.lowerAddr(), self),
+                arrayExport::numpyConstView(addr.upperAddr(), self)
+            );
+        },
+        "(lowerAddr, upperAddr): owner and neighbour cell of every face")
+    .def("patchAddressing",
+        [](nb::handle self)
+        {
+            const fvMatrix<Type>& matrix = nb::cast<const fvMatrix<Type>&>(self);
+            std::vector<nb::ndarray<nb::numpy, const label>> views;
+            forAll(matrix.internalCoeffs(), patchi)
+            {
+                views.push_back
+                (
+                    arrayExport::numpyConstView
+                    (
+                        matrix.lduAddr().patchAddr(patchi), self
+                    )
+                );
+            }
+            return views;
+        },
+        "Face cells of every patch, one array per patch")
+    .def("internalCoeffsArrays",
+        [](nb::handle self)
+        {
+            return patchCoeffViews
+            (
+                nb::cast<const fvMatrix<Type>&>(self).internalCoeffs(), self
+            );
+        },
+        "Diagonal boundary coefficients, one read-only view per patch")
+    .def("boundaryCoeffsArrays",
+        [](nb::handle self)
+        {
+            return patchCoeffViews
+            (
+                nb::cast<const fvMatrix<Type>&>(self).boundaryCoeffs(), self
+            );
+        },
+        "Source boundary coefficients (coupled patches: the coefficients of\n"
+        "the neighbour values), one read-only view per patch")
+    .def("csrPattern",
+        [](nb::handle self)
+        {
+            const lduCSRPattern& pattern = lduCSRPattern::New
+            (
+                nb::cast<const fvMatrix<Type>&>(self).psi().mesh()
+            );
+            return std::make_pair
+            (
+                arrayExport::numpyConstView(pattern.indptr()),
+                arrayExport::numpyConstView(pattern.indices())
+            );
+        },
+        "(indptr, indices) of the matrix in CSR form, cached on the mesh")
+    .def("csrValues",
+        [](const fvMatrix<Type>& self, std::optional<scalarOutArray> out,
+           const direction cmpt, const bool boundary)
+        {
+            const lduCSRPattern& pattern = lduCSRPattern::New(self.psi().mesh());
+            if (cmpt >= pTraits<Type>::nComponents)
+            {
+                throw std::runtime_error("component out of range");
+            }
+
+            scalarOutArray values = outputArray(out, pattern.nnz());
+
+            {
+                nb::gil_scoped_release release;
+                pattern.values(self, values.data(), cmpt, boundary);
+            }
+            return values;
+        },
+        nb::arg("out").noconvert() = nb::none(),
+        nb::arg("cmpt") = 0,
+        nb::arg("boundary") = true,
+        "Coefficients in the order of csrPattern, written into out if given.\n"
+        "With boundary the internalCoeffs (component cmpt) are added to the\n"
+        "diagonal; coupled patch coefficients are not included")
+    .def("Amul",
+        [](const fvMatrix<Type>& self, const scalarArray& x,
+           std::optional<scalarOutArray> out, const direction cmpt)
+        {
+            scalarOutArray Ax = outputArray(out, self.diag().size());
+            {
+                nb::gil_scoped_release release;
+                fvMatrixAmul(self, x, Ax.data(), cmpt, false);
+            }
+            return Ax;
+        },
+        nb::arg("x"),
+        nb::arg("out").noconvert() = nb::none(),
+        nb::arg("cmpt") = 0,
+        "A @ x for component cmpt, written into out if given. Includes the\n"
+        "internalCoeffs and the coupled interfaces, as seen by the linear\n"
+        "solver; x may be an array or a scalarField")
+    .def("residual",
+        [](const fvMatrix<Type>& self, const scalarArray& x,
+           std::optional<scalarOutArray> out, const direction cmpt)
+        {
+            scalarOutArray r = outputArray(out, self.diag().size());
+            {
+                nb::gil_scoped_release release;
+                fvMatrixAmul(self, x, r.data(), cmpt, true);
+            }
+            return r;
+        },
+        nb::arg("x"),
+        nb::arg("out").noconvert() = nb::none(),
+        nb::arg("cmpt") = 0,
+        "csrSource()[:, cmpt] - A @ x, written into out if given")
+    .def("csrSource",
+        [](const fvMatrix<Type>& self)
+        {
+            return arrayExport::numpyArray<Type>(boundarySource(self));
+        },
+        "Right-hand side: source plus the boundaryCoeffs of the uncoupled\n"
+        "patches, as a new array");
+}
+
 template<class Type>
 nb::class_< fvMatrix<Type>>
 declare_fvMatrix(nb::module_ &m, std::string className)
@@ -87,12 +444,24 @@ declare_fvMatrix(nb::module_ &m, std::string className)
         .def(nb::init<tmp<fvMatrix<Type>>>())
         .def("solve", [](fvMatrix<Type> &self)
         {
-            self.solve();
-        })
+            recordSolve(self, [&]
+            {
+                return restoreDiagOnError
+                (
+                    self, self.solverDict(), [&]{ return self.solve(); }
+                );
+            });
+        }, nb::call_guard<nb::gil_scoped_release>())
         .def("solve", [](fvMatrix<Type> &self, const word& name)
         {
-            self.solve(name);
-        })
+            recordSolve(self, [&]
+            {
+                return restoreDiagOnError
+                (
+                    self, self.solverDict(name), [&]{ return self.solve(name); }
+                );
+            });
+        }, nb::call_guard<nb::gil_scoped_release>())
         .def("relax", [](fvMatrix<Type> &self, const scalar& alpha)
         {
             self.relax(alpha);
@@ -161,6 +530,8 @@ declare_fvMatrix(nb::module_ &m, std::string className)
         })
         ;
 
+    bindLduArrays(fvMatrixClass);
+
     return fvMatrixClass;
 
 }
@@ -169,12 +540,158 @@ template<class Type>
 void declare_solve(nb::module_ &m)
 {
     m.def("solve", [](fvMatrix<Type>& mat) {
-        return Foam::solve(mat);
-    });
+        return recordSolve(mat, [&]
+        {
+            return restoreDiagOnError
+            (
+                mat, mat.solverDict(), [&]{ return Foam::solve(mat); }
+            );
+        });
+    }, nb::call_guard<nb::gil_scoped_release>());
 
     m.def("solve", [](const tmp<fvMatrix<Type>>& tmat) {
-        return Foam::solve(tmat);
-    });
+        return recordSolve(tmat(), [&]
+        {
+            return restoreDiagOnError
+            (
+                tmat(), tmat().solverDict(), [&]{ return Foam::solve(tmat); }
+            );
+        });
+    }, nb::call_guard<nb::gil_scoped_release>());
+}
+
+//- Add obj to the concurrent solve if it is a fvMatrix<Type> or its tmp,
+//  the returned function gives the solver performance afterwards
+template<class Type>
+std::function<nb::object()>
+addSolveEntry(concurrentSolve& solver, nb::handle obj)
+{
+    fvMatrix<Type>* matrix = nullptr;
+    if (nb::isinstance<fvMatrix<Type>>(obj))
+    {
+        matrix = &nb::cast<fvMatrix<Type>&>(obj);
+    }
+    else if (nb::isinstance<tmp<fvMatrix<Type>>>(obj))
+    {
+        matrix = &const_cast<fvMatrix<Type>&>
+        (
+            nb::cast<const tmp<fvMatrix<Type>>&>(obj)()
+        );
+    }
+    else
+    {
+        return nullptr;
+    }
+
+    const fvMatrixSolveEntry<Type>& entry = solver.add(*matrix);
+    return [&entry]{ return nb::cast(entry.performance()); };
+}
+
+
+void declare_solve_all(nb::module_ &m)
+{
+    m.def("solve_all",
+        [](const nb::sequence& matrices)
+        {
+            concurrentSolve solver;
+            std::vector<std::function<nb::object()>> results;
+
+            for (nb::handle obj : matrices)
+            {
+                std::function<nb::object()> result =
+                    addSolveEntry<scalar>(solver, obj);
+                if (!result) result = addSolveEntry<vector>(solver, obj);
+                if (!result) result = addSolveEntry<symmTensor>(solver, obj);
+                if (!result) result = addSolveEntry<tensor>(solver, obj);
+                if (!result)
+                {
+                    throw std::runtime_error
+                    (
+                        "solve_all: expected fvMatrix objects, got "
+                      + std::string(nb::type_name(obj.type()).c_str())
+                    );
+                }
+                results.push_back(std::move(result));
+            }
+
+            {
+                nb::gil_scoped_release release;
+                solver.solve();
+            }
+
+            nb::list perf;
+            for (const auto& result : results)
+            {
+                perf.append(result());
+            }
+            return perf;
+        },
+        nb::arg("matrices"),
+        "Solve independent matrices, each for a different field, on the\n"
+        "thread pool (set_num_threads) with the GIL released. Components of\n"
+        "vector/tensor matrices are solved concurrently as well. Returns the\n"
+        "solver performances in the order of the matrices");
+}
+
+void declare_solveTelemetry(nb::module_ &m)
+{
+    nb::class_<solveTelemetry>(m, "solveTelemetry",
+        "Recorder of the linear solves started from Python, see\n"
+        "pybFoam.telemetry")
+        .def_static("instance", &solveTelemetry::instance,
+            nb::rv_policy::reference)
+        .def("enable", &solveTelemetry::enable,
+            nb::arg("capacity") = 65536,
+            "Start recording, keeping the latest capacity solves in memory")
+        .def("disable", &solveTelemetry::disable)
+        .def("enabled", &solveTelemetry::enabled)
+        .def("clear", &solveTelemetry::clear,
+            "Forget the records in memory")
+        .def("__len__", &solveTelemetry::size)
+        .def("names", &solveTelemetry::names,
+            "Field and solver names, indexed by the field/solver columns")
+        .def("arrays",
+            [](const solveTelemetry& self)
+            {
+                const std::vector<solveTelemetry::record> records = self.records();
+                const label n = label(records.size());
+
+                List<scalar> time(n), wallTime(n), initialResidual(n), finalResidual(n);
+                List<label> field(n), solver(n), nIterations(n), converged(n);
+                for (label i = 0; i < n; ++i)
+                {
+                    const solveTelemetry::record& rec = records[i];
+                    time[i] = rec.time;
+                    wallTime[i] = rec.wallTime;
+                    initialResidual[i] = rec.initialResidual;
+                    finalResidual[i] = rec.finalResidual;
+                    field[i] = rec.field;
+                    solver[i] = rec.solver;
+                    nIterations[i] = rec.nIterations;
+                    converged[i] = rec.converged;
+                }
+
+                nb::dict columns;
+                columns["time"] = arrayExport::numpyArray(std::move(time));
+                columns["wall_time"] = arrayExport::numpyArray(std::move(wallTime));
+                columns["initial_residual"] = arrayExport::numpyArray(std::move(initialResidual));
+                columns["final_residual"] = arrayExport::numpyArray(std::move(finalResidual));
+                columns["field"] = arrayExport::numpyArray(std::move(field));
+                columns["solver"] = arrayExport::numpyArray(std::move(solver));
+                columns["iterations"] = arrayExport::numpyArray(std::move(nIterations));
+                columns["converged"] = arrayExport::numpyArray(std::move(converged));
+                return columns;
+            },
+            "Records in memory, oldest first, as a dict of NumPy columns")
+        .def("open", &solveTelemetry::open,
+            nb::arg("path"),
+            "Stream all further records to a binary file from a background thread")
+        .def("flush", &solveTelemetry::flush,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Wait until all records are written")
+        .def("close", &solveTelemetry::close,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Write the pending records and close the file");
 }
 
 template<class Type>
@@ -192,6 +709,167 @@ declare_SolverPerformance(nb::module_ &m, std::string className)
         .def("singular", &Foam::SolverPerformance<Type>::singular);
 }
 
+
+void declare_pythonSolver(nb::module_ &m)
+{
+    nb::class_<pythonSolverSystem>(m, "pythonSolverSystem",
+        "Linear system passed to a solver registered with register_linear_solver")
+        .def("fieldName",
+            [](const pythonSolverSystem& self) -> std::string
+            {
+                return self.solver().fieldName();
+            })
+        .def("cmpt", &pythonSolverSystem::cmpt,
+            "Component being solved")
+        .def("tolerance",
+            [](const pythonSolverSystem& self) { return self.solver().tolerance(); })
+        .def("relTol",
+            [](const pythonSolverSystem& self) { return self.solver().relTol(); })
+        .def("maxIter",
+            [](const pythonSolverSystem& self) { return self.solver().maxIter(); })
+        .def("psi",
+            [](nb::handle self)
+            {
+                return arrayExport::numpyView
+                (
+                    nb::cast<pythonSolverSystem&>(self).psi(), self
+                );
+            },
+            "Solution, initial guess on entry; write the result into it")
+        .def("source",
+            [](nb::handle self)
+            {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const pythonSolverSystem&>(self).source(), self
+                );
+            },
+            "Right-hand side, read-only view")
+        .def("diagArray",
+            [](nb::handle self)
+            {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const pythonSolverSystem&>(self).solver().matrix().diag(),
+                    self
+                );
+            },
+            "Diagonal coefficients including the boundary contributions")
+        .def("upperArray",
+            [](nb::handle self)
+            {
+                const lduMatrix& matrix =
+                    nb::cast<const pythonSolverSystem&>(self).solver().matrix();
+                if (!matrix.hasUpper() && !matrix.hasLower())
+                {
+                    throw std::runtime_error("matrix has no off-diagonal coefficients");
+                }
+                return arrayExport::numpyConstView(matrix.upper(), self);
+            },
+            "Coefficient (lowerAddr[f], upperAddr[f]) of every face")
+        .def("lowerArray",
+            [](nb::handle self)
+            {
+                const lduMatrix& matrix =
+                    nb::cast<const pythonSolverSystem&>(self).solver().matrix();
+                if (!matrix.hasUpper() && !matrix.hasLower())
+                {
+                    throw std::runtime_error("matrix has no off-diagonal coefficients");
+                }
+                return arrayExport::numpyConstView(matrix.lower(), self);
+            },
+            "Coefficient (upperAddr[f], lowerAddr[f]) of every face")
+        .def("lduAddressing",
+            [](nb::handle self)
+            {
+                const lduAddressing& addr =
+                    nb::cast<const pythonSolverSystem&>(self).solver().matrix().lduAddr();
+                return std::make_pair
+                (
+                    arrayExport::numpyConstView(addr.lowerAddr(), self),
+                    arrayExport::numpyConstView(addr.upperAddr(), self)
+                );
+            },
+            "(lowerAddr, upperAddr): owner and neighbour cell of every face")
+        .def("csrPattern",
+            [](nb::handle self)
+            {
+                const lduMatrix& matrix =
+                    nb::cast<const pythonSolverSystem&>(self).solver().matrix();
+                const auto* mesh = dynamic_cast<const fvMesh*>(&matrix.mesh());
+                if (!mesh)
+                {
+                    throw std::runtime_error("matrix is not on an fvMesh");
+                }
+                const lduCSRPattern& pattern = lduCSRPattern::New(*mesh);
+                return std::make_pair
+                (
+                    arrayExport::numpyConstView(pattern.indptr()),
+                    arrayExport::numpyConstView(pattern.indices())
+                );
+            },
+            "(indptr, indices) of the matrix in CSR form, cached on the mesh")
+        .def("csrValues",
+            [](const pythonSolverSystem& self, std::optional<scalarOutArray> out)
+            {
+                const lduMatrix& matrix = self.solver().matrix();
+                const auto* mesh = dynamic_cast<const fvMesh*>(&matrix.mesh());
+                if (!mesh)
+                {
+                    throw std::runtime_error("matrix is not on an fvMesh");
+                }
+                const lduCSRPattern& pattern = lduCSRPattern::New(*mesh);
+
+                scalarOutArray values = outputArray(out, pattern.nnz());
+
+                {
+                    nb::gil_scoped_release release;
+                    pattern.values(matrix, values.data());
+                }
+                return values;
+            },
+            nb::arg("out").noconvert() = nb::none(),
+            "Coefficients in the order of csrPattern (coupled interfaces not\n"
+            "included), written into out if given")
+        .def("Amul",
+            [](const pythonSolverSystem& self, const scalarArray& x)
+            {
+                scalarField xf(checkArrayShape<scalar>(x));
+                copyFromArray(xf, x);
+                return arrayExport::numpyArray<scalar>(scalarField(self.Amul(xf)));
+            },
+            nb::arg("x"),
+            "A @ x including the coupled interfaces")
+        .def("residual",
+            [](const pythonSolverSystem& self, const scalarArray& x)
+            {
+                scalarField xf(checkArrayShape<scalar>(x));
+                copyFromArray(xf, x);
+                return arrayExport::numpyArray<scalar>(scalarField(self.residual(xf)));
+            },
+            nb::arg("x"),
+            "source - A @ x including the coupled interfaces");
+
+    m.def("register_linear_solver",
+        [](const std::string& name, nb::callable function)
+        {
+            pythonSolver::callbacks()[name.c_str()] = function;
+        },
+        nb::arg("name"),
+        nb::arg("function"),
+        "Register function(system) as the linear solver selected in fvSolution\n"
+        "by 'solver python; callback <name>;'. It solves system.psi() in place\n"
+        "and may return the number of iterations");
+
+    m.def("unregister_linear_solver",
+        [](const std::string& name)
+        {
+            pythonSolver::callbacks().attr("pop")(name.c_str(), nb::none());
+        },
+        nb::arg("name"),
+        "Remove a linear solver registered with register_linear_solver");
+}
+
 }
 
 void Foam::bindFvMatrix(nb::module_& m)
@@ -209,5 +887,7 @@ void Foam::bindFvMatrix(nb::module_& m)
     declare_solve<Foam::vector>(m);
     declare_solve<Foam::tensor>(m);
     declare_solve<Foam::symmTensor>(m);
-
+    declare_solve_all(m);
+    declare_solveTelemetry(m);
+    declare_pythonSolver(m);
 }
@@ -20,6 +20,10 @@ License
 #include "bind_fvmesh.hpp"
 #include "bind_time.hpp"
 #include "bind_polymesh.hpp"
+#include "meshTopologyArrays.hpp"
+#include "inMemoryMesh.hpp"
+#include "arrayExport.hpp"
+#include "bind_fields.hpp"
 #include <memory>
 #include <nanobind/make_iterator.h>
 #include "volFields.H"
@@ -30,6 +34,7 @@ License
 #include "fvBoundaryMesh.H"
 #include "fvPatch.H"
 #include "IOobject.H"
+#include "fvMeshSubset.H"
 
 namespace Foam
 {
@@ -54,23 +59,19 @@ namespace Foam
 
     fvMesh *createMeshFromPolyMesh(polyMesh& polyMeshRef, bool autoWrite)
     {
-        // Write the polyMesh to disk
-        polyMeshRef.write();
-
-        // Get the time and location info from the polyMesh
-        const Time& time = polyMeshRef.time();
-        const word& regionName = polyMeshRef.name();
-
-        // Create fvMesh by reading from disk where polyMesh was written
-        fvMesh *mesh(
-            new fvMesh(
-                IOobject(
-                    regionName,
-                    time.timeName(),
-                    time,
-                    IOobject::MUST_READ),
-                false));
-        mesh->init(true);
+        // Copy the topology into a new fvMesh, nothing is read or written
+        fvMesh *mesh = newFvMesh
+        (
+            polyMeshRef,
+            IOobject
+            (
+                polyMeshRef.name(),
+                polyMeshRef.pointsInstance(),
+                polyMeshRef.time(),
+                IOobject::NO_READ,
+                IOobject::NO_WRITE
+            )
+        );
 
         if (autoWrite)
         {
@@ -80,6 +81,19 @@ namespace Foam
         return mesh;
     }
 
+    // fvMeshSubset::interpolate of a volume field onto the subset mesh
+    template<class Type>
+    void bindSubsetInterpolate(nanobind::class_<fvMeshSubset>& cls)
+    {
+        cls.def("interpolate",
+            [](const fvMeshSubset& self, const GeometricField<Type, fvPatchField, volMesh>& vf)
+            {
+                return self.interpolate(vf);
+            },
+            nanobind::arg("field"),
+            "Copy of field on the subset mesh");
+    }
+
 }
 
 void bindFvMesh(nanobind::module_ &m)
@@ -117,7 +131,8 @@ void bindFvMesh(nanobind::module_ &m)
         .def("start", [](const Foam::fvPatch& self) { return self.start(); })
         .def("index", [](const Foam::fvPatch& self) { return self.index(); });
 
-    nb::class_<Foam::fvMesh>(m, "fvMesh")
+    nb::class_<Foam::fvMesh> fvMeshClass(m, "fvMesh");
+    fvMeshClass
         .def("__init__", [](Foam::fvMesh* self, const Foam::Time& time, bool autoWrite) {
              new (self) Foam::fvMesh(
                 IOobject(
@@ -138,7 +153,7 @@ void bindFvMesh(nanobind::module_ &m)
             },
             nb::arg("polyMesh"), nb::arg("autoWrite") = false,
             nb::rv_policy::take_ownership,
-            "Create fvMesh from polyMesh by writing to disk and reading back")
+            "Create fvMesh from polyMesh in memory, written only with autoWrite")
         .def("nCells", [](const Foam::fvMesh& self)
         {
             return self.nCells();
@@ -184,6 +199,67 @@ void bindFvMesh(nanobind::module_ &m)
              { return self.changing(); })
         ;
 
+    Foam::bindMeshArrays(fvMeshClass);
+
+    // Subset mesh of a list of cells or a cellZone, e.g. to assemble and
+    // solve fvm equations on a region only
+    nb::class_<Foam::fvMeshSubset> subsetClass(m, "fvMeshSubset");
+    subsetClass
+        .def("__init__",
+            [](Foam::fvMeshSubset* self, const Foam::fvMesh& mesh, const labelArray& cells)
+            {
+                if (cells.ndim() != 1)
+                {
+                    throw std::runtime_error("fvMeshSubset: expected a 1-D array of cells");
+                }
+                new (self) Foam::fvMeshSubset
+                (
+                    mesh,
+                    Foam::labelUList(const_cast<Foam::label*>(cells.data()), Foam::label(cells.shape(0)))
+                );
+            },
+            nb::arg("mesh"), nb::arg("cells"), nb::keep_alive<1, 2>(),
+            "Subset of the given cells; exposed internal faces form the\n"
+            "patch oldInternalFaces")
+        .def("__init__",
+            [](Foam::fvMeshSubset* self, const Foam::fvMesh& mesh, const std::string& zone)
+            {
+                const Foam::label zonei = mesh.cellZones().findZoneID(zone);
+                if (zonei < 0)
+                {
+                    throw std::runtime_error("fvMeshSubset: no cellZone named " + zone);
+                }
+                new (self) Foam::fvMeshSubset(mesh, mesh.cellZones()[zonei]);
+            },
+            nb::arg("mesh"), nb::arg("zone"), nb::keep_alive<1, 2>(),
+            "Subset of the cells of a cellZone")
+        .def("subMesh",
+            [](Foam::fvMeshSubset& self) -> Foam::fvMesh& { return self.subMesh(); },
+            nb::rv_policy::reference_internal)
+        .def("baseMesh", &Foam::fvMeshSubset::baseMesh, nb::rv_policy::reference)
+        .def("cellMap",
+            [](nb::handle self)
+            {
+                return Foam::arrayExport::numpyConstView
+                (
+                    nb::cast<const Foam::fvMeshSubset&>(self).cellMap(), self
+                );
+            },
+            "Base mesh cell of every subset cell, read-only view")
+        .def("faceMap",
+            [](nb::handle self)
+            {
+                return Foam::arrayExport::numpyConstView
+                (
+                    nb::cast<const Foam::fvMeshSubset&>(self).faceMap(), self
+                );
+            },
+            "Base mesh face of every subset face, read-only view");
+
+    Foam::bindSubsetInterpolate<Foam::scalar>(subsetClass);
+    Foam::bindSubsetInterpolate<Foam::vector>(subsetClass);
+    Foam::bindSubsetInterpolate<Foam::symmTensor>(subsetClass);
+    Foam::bindSubsetInterpolate<Foam::tensor>(subsetClass);
 
         nb::class_<Foam::dynamicFvMesh, Foam::fvMesh>(m, "dynamicFvMesh")
         .def_static("New", [](
@@ -18,12 +18,53 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "bind_geo_fields.hpp"
+#include "fieldKernels.hpp"
+#include "arrayExport.hpp"
+#include "bind_fields.hpp"
+#include "patchIndexTable.hpp"
+#include "fieldIntegrals.hpp"
 #include "tmp.H"
 #include "bound.H"
 
 namespace Foam
 {
 
+// Element-wise functions evaluated by the thread pool (fieldKernels.hpp)
+
+template<class Type, template<class> class PatchField, class GeoMesh>
+tmp<GeometricField<scalar, PatchField, GeoMesh>>
+magField(const GeometricField<Type, PatchField, GeoMesh>& gf)
+{
+    return kernels::unary<scalar>
+    (
+        gf, "mag(" + gf.name() + ')', gf.dimensions(),
+        kernels::magOp()
+    );
+}
+
+template<class Type, template<class> class PatchField, class GeoMesh>
+tmp<GeometricField<scalar, PatchField, GeoMesh>>
+magSqrField(const GeometricField<Type, PatchField, GeoMesh>& gf)
+{
+    return kernels::unary<scalar>
+    (
+        gf, "magSqr(" + gf.name() + ')', sqr(gf.dimensions()),
+        kernels::magSqrOp()
+    );
+}
+
+template<class Result, class Type, class Op>
+tmp<GeometricField<Result, fvPatchField, volMesh>> volFunction
+(
+    const word& func,
+    const VolumeField<Type>& f,
+    const dimensionSet& dims,
+    const Op& op
+)
+{
+    return kernels::unary<Result>(f, func + '(' + f.name() + ')', dims, op);
+}
+
 template<class Type, template<class> class PatchField, class GeoMesh>
 Field<Type>& field(GeometricField<Type, PatchField, GeoMesh>& gf, const std::string& name)
 {
@@ -33,7 +74,7 @@ Field<Type>& field(GeometricField<Type, PatchField, GeoMesh>& gf, const std::str
     }
     else
     {
-        label patchId = gf.mesh().boundaryMesh().findPatchID(name);
+        label patchId = patchIndexTable::New(gf.mesh()).find(name);
         if (patchId == -1)
         {
             FatalErrorInFunction
@@ -53,7 +94,7 @@ void field(GeometricField<Type, PatchField, GeoMesh>& gf, const std::string& nam
     }
     else
     {
-        label patchId = gf.mesh().boundaryMesh().findPatchID(name);
+        label patchId = patchIndexTable::New(gf.mesh()).find(name);
         if (patchId == -1)
         {
             FatalErrorInFunction
@@ -64,6 +105,149 @@ void field(GeometricField<Type, PatchField, GeoMesh>& gf, const std::string& nam
     }
 }
 
+// All boundary values in patch order, i.e. boundary-face order. Patches
+// without values (empty) contribute no entries.
+
+template<class Type, template<class> class PatchField, class GeoMesh>
+List<label> boundaryOffsets(const GeometricField<Type, PatchField, GeoMesh>& gf)
+{
+    const auto& bf = gf.boundaryField();
+
+    List<label> offsets(bf.size() + 1);
+    offsets[0] = 0;
+    forAll(bf, patchi)
+    {
+        offsets[patchi + 1] = offsets[patchi] + bf[patchi].size();
+    }
+    return offsets;
+}
+
+template<class Type, template<class> class PatchField, class GeoMesh>
+Field<Type> boundaryValues(const GeometricField<Type, PatchField, GeoMesh>& gf)
+{
+    const auto& bf = gf.boundaryField();
+    const List<label> offsets(boundaryOffsets(gf));
+
+    Field<Type> values(offsets.last());
+    forAll(bf, patchi)
+    {
+        SubList<Type>(values, bf[patchi].size(), offsets[patchi]) = bf[patchi];
+    }
+    return values;
+}
+
+template<class Type, template<class> class PatchField, class GeoMesh>
+void setBoundaryValues
+(
+    GeometricField<Type, PatchField, GeoMesh>& gf,
+    const scalarArray& arr
+)
+{
+    auto& bf = gf.boundaryFieldRef();
+    const List<label> offsets(boundaryOffsets(gf));
+
+    const label n = checkArrayShape<Type>(arr);
+    if (n != offsets.last())
+    {
+        throw std::runtime_error
+        (
+            "Array size " + std::to_string(n)
+          + " does not match the number of boundary values "
+          + std::to_string(offsets.last())
+        );
+    }
+
+    // Same semantics as assigning each patch with __setitem__
+    const UList<Type> values
+    (
+        reinterpret_cast<Type*>(const_cast<scalar*>(arr.data())),
+        n
+    );
+    forAll(bf, patchi)
+    {
+        bf[patchi] = SubList<Type>(values, bf[patchi].size(), offsets[patchi]);
+    }
+}
+
+// Fused reductions of volume fields, one pass and one reduce across ranks
+template<class Type>
+void bindIntegrals(nb::module_& m)
+{
+    typedef VolumeField<Type> fieldType;
+
+    m.def("domainIntegrate",
+        [](const fieldType& f) { return fieldIntegrals::domain(f).sum; },
+        nb::arg("field"), nb::call_guard<nb::gil_scoped_release>(),
+        "Volume integral of the internal field over all processors");
+    m.def("domainIntegrate",
+        [](const tmp<fieldType>& f) { return fieldIntegrals::domain(f()).sum; },
+        nb::arg("field"), nb::call_guard<nb::gil_scoped_release>());
+    m.def("weightedAverage",
+        [](const fieldType& f) { return fieldIntegrals::domain(f).average(); },
+        nb::arg("field"), nb::call_guard<nb::gil_scoped_release>(),
+        "Volume weighted average of the internal field over all processors");
+    m.def("weightedAverage",
+        [](const tmp<fieldType>& f) { return fieldIntegrals::domain(f()).average(); },
+        nb::arg("field"), nb::call_guard<nb::gil_scoped_release>());
+    m.def("cellZoneIntegrate",
+        [](const fieldType& f, const std::string& zone)
+        {
+            return fieldIntegrals::cellZone(f, word(zone)).sum;
+        },
+        nb::arg("field"), nb::arg("zone"), nb::call_guard<nb::gil_scoped_release>(),
+        "Volume integral over the cells of a cellZone");
+    m.def("cellZoneAverage",
+        [](const fieldType& f, const std::string& zone)
+        {
+            return fieldIntegrals::cellZone(f, word(zone)).average();
+        },
+        nb::arg("field"), nb::arg("zone"), nb::call_guard<nb::gil_scoped_release>(),
+        "Volume weighted average over the cells of a cellZone");
+}
+
+// Area weighted reductions of the patch values of volume and surface fields
+template<class Type, template<class> class PatchField, class GeoMesh>
+void bindPatchIntegrals(nb::module_& m)
+{
+    typedef GeometricField<Type, PatchField, GeoMesh> fieldType;
+
+    m.def("patchIntegrate",
+        [](const fieldType& f, const std::string& patch)
+        {
+            const label patchi = fieldIntegrals::patchIndex(f.mesh(), word(patch));
+            return fieldIntegrals::patch(f, patchi).sum;
+        },
+        nb::arg("field"), nb::arg("patch"), nb::call_guard<nb::gil_scoped_release>(),
+        "Area integral of the values on a non-processor patch");
+    m.def("patchAverage",
+        [](const fieldType& f, const std::string& patch)
+        {
+            const label patchi = fieldIntegrals::patchIndex(f.mesh(), word(patch));
+            return fieldIntegrals::patch(f, patchi).average();
+        },
+        nb::arg("field"), nb::arg("patch"), nb::call_guard<nb::gil_scoped_release>(),
+        "Area weighted average of the values on a non-processor patch");
+    m.def("patchIntegrals",
+        [](const fieldType& f)
+        {
+            List<fieldIntegrals::weightedSum<Type>> sums;
+            {
+                nb::gil_scoped_release release;
+                sums = fieldIntegrals::patches(f);
+            }
+
+            nb::dict result;
+            forAll(sums, patchi)
+            {
+                result[f.mesh().boundary()[patchi].name().c_str()] = nb::cast(sums[patchi].sum);
+            }
+            return result;
+        },
+        nb::arg("field"),
+        "Area integrals of all non-processor patches from one reduction, keyed by\n"
+        "patch name");
+}
+
 template<class Type, template<class> class PatchField, class GeoMesh>
 auto declare_geofields(nb::module_ &m, std::string className) {
     std::string tmp_className = "tmp_" + className;
@@ -203,6 +387,32 @@ auto declare_geofields(nb::module_ &m, std::string className) {
     {
         Foam::field(self,name,f);
     })
+    .def("patchIndex", []
+    (
+        const Foam::GeometricField<Type, PatchField, GeoMesh>& self,
+        const std::string& name
+    )
+    {
+        return patchIndexTable::New(self.mesh()).index(name);
+    }, nb::arg("name"),
+        "Index of the patch in boundaryOffsets(); the lookup is cached on the mesh")
+    .def("boundaryOffsets", [](const Foam::GeometricField<Type, PatchField, GeoMesh>& self)
+    {
+        return arrayExport::numpyArray(boundaryOffsets(self));
+    }, "Start of each patch in boundaryArray(), followed by the total size")
+    .def("boundaryArray", [](const Foam::GeometricField<Type, PatchField, GeoMesh>& self)
+    {
+        return arrayExport::numpyArray<Type>(boundaryValues(self));
+    }, "Copy of all patch values as one array, patch after patch")
+    .def("setBoundaryArray", []
+    (
+        Foam::GeometricField<Type, PatchField, GeoMesh>& self,
+        const scalarArray& values
+    )
+    {
+        setBoundaryValues(self, values);
+    }, nb::arg("values"),
+        "Assign all patch values from one array laid out like boundaryArray()")
     .def("__add__", []
     (
         Foam::GeometricField<Type, PatchField, GeoMesh>& self,
@@ -501,48 +711,82 @@ void Foam::bindGeoFields(nb::module_& m)
 
     // Functions
 
+    // Element-wise functions below run multithreaded with the GIL released
+
     // mag
-    m.def("mag", [](const VolumeField<scalar>& f) { return Foam::mag(f); });
-    m.def("mag", [](const VolumeField<vector>& f) { return Foam::mag(f); });
-    m.def("mag", [](const VolumeField<tensor>& f) { return Foam::mag(f); });
-    m.def("mag", [](const VolumeField<symmTensor>& f) { return Foam::mag(f); });
+    m.def("mag", [](const VolumeField<scalar>& f) { return magField(f); });
+    m.def("mag", [](const VolumeField<vector>& f) { return magField(f); });
+    m.def("mag", [](const VolumeField<tensor>& f) { return magField(f); });
+    m.def("mag", [](const VolumeField<symmTensor>& f) { return magField(f); });
 
-    m.def("mag", [](const SurfaceField<scalar>& f) { return Foam::mag(f); });
-    m.def("mag", [](const SurfaceField<vector>& f) { return Foam::mag(f); });
-    m.def("mag", [](const SurfaceField<tensor>& f) { return Foam::mag(f); });
+    m.def("mag", [](const SurfaceField<scalar>& f) { return magField(f); });
+    m.def("mag", [](const SurfaceField<vector>& f) { return magField(f); });
+    m.def("mag", [](const SurfaceField<tensor>& f) { return magField(f); });
 
     // magSqr
-    m.def("magSqr", [](const VolumeField<scalar>& f) { return Foam::magSqr(f); });
-    m.def("magSqr", [](const VolumeField<vector>& f) { return Foam::magSqr(f); });
-    m.def("magSqr", [](const VolumeField<tensor>& f) { return Foam::magSqr(f); });
-    m.def("magSqr", [](const tmp<VolumeField<tensor>>& f) { return Foam::magSqr(f); });
-    m.def("magSqr", [](const tmp<VolumeField<vector>>& f) { return Foam::magSqr(f); });
+    m.def("magSqr", [](const VolumeField<scalar>& f) { return magSqrField(f); });
+    m.def("magSqr", [](const VolumeField<vector>& f) { return magSqrField(f); });
+    m.def("magSqr", [](const VolumeField<tensor>& f) { return magSqrField(f); });
+    m.def("magSqr", [](const tmp<VolumeField<tensor>>& f) { return magSqrField(f()); });
+    m.def("magSqr", [](const tmp<VolumeField<vector>>& f) { return magSqrField(f()); });
 
     // sqr (scalar → scalar, vector → symmTensor)
-    m.def("sqr", [](const VolumeField<scalar>& f) { return Foam::sqr(f); });
-    m.def("sqr", [](const tmp<VolumeField<scalar>>& f) { return Foam::sqr(f); });
+    const auto sqrFunc = [](const volScalarField& f)
+    {
+        return volFunction<scalar>("sqr", f, sqr(f.dimensions()), [](const scalar x) { return Foam::sqr(x); });
+    };
+    m.def("sqr", sqrFunc);
+    m.def("sqr", [sqrFunc](const tmp<VolumeField<scalar>>& f) { return sqrFunc(f()); });
 
     // sqrt
-    m.def("sqrt", [](const VolumeField<scalar>& f) { return Foam::sqrt(f); });
-    m.def("sqrt", [](const tmp<VolumeField<scalar>>& f) { return Foam::sqrt(f); });
+    const auto sqrtFunc = [](const volScalarField& f)
+    {
+        return volFunction<scalar>("sqrt", f, sqrt(f.dimensions()), [](const scalar x) { return Foam::sqrt(x); });
+    };
+    m.def("sqrt", sqrtFunc);
+    m.def("sqrt", [sqrtFunc](const tmp<VolumeField<scalar>>& f) { return sqrtFunc(f()); });
 
     // pow3, pow6
-    m.def("pow3", [](const volScalarField& f) { return Foam::pow3(f); });
-    m.def("pow3", [](const tmp<volScalarField>& f) { return Foam::pow3(f); });
-    m.def("pow6", [](const volScalarField& f) { return Foam::pow6(f); });
-    m.def("pow6", [](const tmp<volScalarField>& f) { return Foam::pow6(f); });
+    const auto pow3Func = [](const volScalarField& f)
+    {
+        return volFunction<scalar>("pow3", f, pow3(f.dimensions()), [](const scalar x) { return Foam::pow3(x); });
+    };
+    const auto pow6Func = [](const volScalarField& f)
+    {
+        return volFunction<scalar>("pow6", f, pow6(f.dimensions()), [](const scalar x) { return Foam::pow6(x); });
+    };
+    m.def("pow3", pow3Func);
+    m.def("pow3", [pow3Func](const tmp<volScalarField>& f) { return pow3Func(f()); });
+    m.def("pow6", pow6Func);
+    m.def("pow6", [pow6Func](const tmp<volScalarField>& f) { return pow6Func(f()); });
 
     // skew (tensor → tensor)
-    m.def("skew", [](const volTensorField& f) { return Foam::skew(f); });
-    m.def("skew", [](const tmp<volTensorField>& f) { return Foam::skew(f); });
+    const auto skewFunc = [](const volTensorField& f)
+    {
+        return volFunction<tensor>("skew", f, f.dimensions(), [](const tensor& t) { return Foam::skew(t); });
+    };
+    m.def("skew", skewFunc);
+    m.def("skew", [skewFunc](const tmp<volTensorField>& f) { return skewFunc(f()); });
 
     // symm (tensor → symmTensor)
-    m.def("symm", [](const volTensorField& f) { return Foam::symm(f); });
-    m.def("symm", [](const tmp<volTensorField>& f) { return Foam::symm(f); });
+    const auto symmFunc = [](const volTensorField& f)
+    {
+        return volFunction<symmTensor>("symm", f, f.dimensions(), kernels::symmOp());
+    };
+    m.def("symm", symmFunc);
+    m.def("symm", [symmFunc](const tmp<volTensorField>& f) { return symmFunc(f()); });
 
     // T (transpose: tensor → tensor)
-    m.def("T", [](const volTensorField& f) { return f.T(); });
-    m.def("T", [](const tmp<volTensorField>& f) { return f().T(); });
+    const auto TFunc = [](const volTensorField& f)
+    {
+        return kernels::unary<tensor>
+        (
+            f, f.name() + ".T()", f.dimensions(),
+            [](const tensor& t) { return t.T(); }
+        );
+    };
+    m.def("T", TFunc);
+    m.def("T", [TFunc](const tmp<volTensorField>& f) { return TFunc(f()); });
 
     // max/min for field vs scalar/field
     m.def("max", [](const volScalarField& f, const dimensionedScalar& s) { return Foam::max(f, s); });
@@ -584,24 +828,56 @@ void Foam::bindGeoFields(nb::module_& m)
     });
 
     // devTwoSymm (tensor → symmTensor)
-    m.def("devTwoSymm", [](const volTensorField& T) { return Foam::devTwoSymm(T); });
-    m.def("devTwoSymm", [](const tmp<volTensorField>& T) { return Foam::devTwoSymm(T); });
+    const auto devTwoSymmFunc = [](const volTensorField& T)
+    {
+        return volFunction<symmTensor>("devTwoSymm", T, T.dimensions(), [](const tensor& t) { return Foam::devTwoSymm(t); });
+    };
+    m.def("devTwoSymm", devTwoSymmFunc);
+    m.def("devTwoSymm", [devTwoSymmFunc](const tmp<volTensorField>& T) { return devTwoSymmFunc(T()); });
 
     // dev2 (deviatoric: T - (2/3)*tr(T)*I for symmTensor and tensor)
-    m.def("dev2", [](const volSymmTensorField& T) { return Foam::dev2(T); });
-    m.def("dev2", [](const tmp<volSymmTensorField>& T) { return Foam::dev2(T); });
-    m.def("dev2", [](const volTensorField& T) { return Foam::dev2(T); });
-    m.def("dev2", [](const tmp<volTensorField>& T) { return Foam::dev2(T); });
+    const auto dev2SymmFunc = [](const volSymmTensorField& T)
+    {
+        return volFunction<symmTensor>("dev2", T, T.dimensions(), kernels::dev2Op());
+    };
+    const auto dev2Func = [](const volTensorField& T)
+    {
+        return volFunction<tensor>("dev2", T, T.dimensions(), kernels::dev2Op());
+    };
+    m.def("dev2", dev2SymmFunc);
+    m.def("dev2", [dev2SymmFunc](const tmp<volSymmTensorField>& T) { return dev2SymmFunc(T()); });
+    m.def("dev2", dev2Func);
+    m.def("dev2", [dev2Func](const tmp<volTensorField>& T) { return dev2Func(T()); });
 
 
     // && (double inner product: tensor && symmTensor → scalar)
-    m.def("doubleInner", [](const volTensorField& T, const volSymmTensorField& S)
+    const auto doubleInnerFunc = [](const volTensorField& T, const volSymmTensorField& S)
     {
-        return T && S;
-    });
-    m.def("doubleInner", [](const volTensorField& T, const tmp<volSymmTensorField>& S)
+        return kernels::binary<scalar>
+        (
+            T, S, '(' + T.name() + "&&" + S.name() + ')', T.dimensions()*S.dimensions(),
+            kernels::doubleInnerOp()
+        );
+    };
+    m.def("doubleInner", doubleInnerFunc);
+    m.def("doubleInner", [doubleInnerFunc](const volTensorField& T, const tmp<volSymmTensorField>& S)
     {
-        return T && S;
+        return doubleInnerFunc(T, S());
     });
 
+
+    // Integrals and averages
+    bindIntegrals<scalar>(m);
+    bindIntegrals<vector>(m);
+    bindIntegrals<symmTensor>(m);
+    bindIntegrals<tensor>(m);
+
+    bindPatchIntegrals<scalar, fvPatchField, volMesh>(m);
+    bindPatchIntegrals<vector, fvPatchField, volMesh>(m);
+    bindPatchIntegrals<symmTensor, fvPatchField, volMesh>(m);
+    bindPatchIntegrals<tensor, fvPatchField, volMesh>(m);
+    bindPatchIntegrals<scalar, fvsPatchField, surfaceMesh>(m);
+    bindPatchIntegrals<vector, fvsPatchField, surfaceMesh>(m);
+    bindPatchIntegrals<symmTensor, fvsPatchField, surfaceMesh>(m);
+    bindPatchIntegrals<tensor, fvsPatchField, surfaceMesh>(m);
 }
@@ -18,6 +18,7 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "bind_polymesh.hpp"
+#include "meshTopologyArrays.hpp"
 #include "polyMesh.H"
 #include "polyBoundaryMesh.H"
 #include "polyPatch.H"
@@ -29,6 +30,11 @@ License
 #include "cellShape.H"
 #include "cellModel.H"
 #include "Time.H"
+#include "SubList.H"
+#include "parallelFor.hpp"
+
+#include <stdexcept>
+#include <string>
 
 namespace Foam
 {
@@ -142,6 +148,219 @@ void createPolyMeshFromCellShapes(
     );
 }
 
+namespace
+{
+
+Foam::pointField pointsFromArray(const Foam::scalarArray& points)
+{
+    Foam::pointField pts(Foam::checkArrayShape<Foam::vector>(points));
+    Foam::copyFromArray(pts, points);
+    return pts;
+}
+
+
+Foam::labelList labelsFromArray(const Foam::labelArray& arr, const char* name)
+{
+    if (arr.ndim() != 1)
+    {
+        throw std::runtime_error(std::string("Expected 1D array for ") + name);
+    }
+
+    Foam::labelList list(arr.shape(0));
+    if (list.size())
+    {
+        std::memcpy(list.data(), arr.data(), list.size()*sizeof(Foam::label));
+    }
+    return list;
+}
+
+
+// CSR arrays to faceList, the faces are filled in parallel
+Foam::faceList facesFromArrays
+(
+    const Foam::labelArray& offsets,
+    const Foam::labelArray& labels,
+    const Foam::label nPoints
+)
+{
+    using namespace Foam;
+
+    if (offsets.ndim() != 1 || labels.ndim() != 1 || offsets.shape(0) < 1)
+    {
+        throw std::runtime_error
+        (
+            "Expected 1D offsets of size nFaces + 1 and 1D point labels"
+        );
+    }
+
+    const label nFaces = offsets.shape(0) - 1;
+    const label* off = offsets.data();
+    const label* lab = labels.data();
+
+    if (off[0] != 0 || off[nFaces] != label(labels.shape(0)))
+    {
+        throw std::runtime_error
+        (
+            "Face offsets must start at 0 and end at the number of point labels"
+        );
+    }
+    for (label facei = 0; facei < nFaces; ++facei)
+    {
+        if (off[facei + 1] < off[facei] + 3)
+        {
+            throw std::runtime_error
+            (
+                "Face " + std::to_string(facei) + " has fewer than 3 points"
+            );
+        }
+    }
+    for (label i = 0; i < off[nFaces]; ++i)
+    {
+        if (lab[i] < 0 || lab[i] >= nPoints)
+        {
+            throw std::runtime_error
+            (
+                "Point label " + std::to_string(lab[i]) + " out of range"
+            );
+        }
+    }
+
+    faceList faces(nFaces);
+    {
+        nb::gil_scoped_release release;
+        parallel::parallelFor
+        (
+            nFaces,
+            [&](const label start, const label end)
+            {
+                for (label facei = start; facei < end; ++facei)
+                {
+                    face& f = faces[facei];
+                    f.resize(off[facei + 1] - off[facei]);
+                    std::memcpy
+                    (
+                        f.data(), lab + off[facei], f.size()*sizeof(label)
+                    );
+                }
+            }
+        );
+    }
+    return faces;
+}
+
+} // End anonymous namespace
+
+
+void createPolyMeshFromArrays(
+    polyMesh* self,
+    const IOobject& io,
+    const scalarArray& points,
+    const labelArray& faceOffsets,
+    const labelArray& facePoints,
+    const labelArray& owner,
+    const labelArray& neighbour,
+    bool syncPar)
+{
+    pointField pts(pointsFromArray(points));
+    faceList fl(facesFromArrays(faceOffsets, facePoints, pts.size()));
+    labelList own(labelsFromArray(owner, "owner"));
+    labelList nei(labelsFromArray(neighbour, "neighbour"));
+
+    if (own.size() != fl.size() || nei.size() > fl.size())
+    {
+        throw std::runtime_error
+        (
+            "owner must have one entry per face and neighbour one per"
+            " internal face"
+        );
+    }
+
+    new (self) polyMesh(io, std::move(pts), std::move(fl), std::move(own), std::move(nei), syncPar);
+}
+
+void createPolyMeshFromCellArrays(
+    polyMesh* self,
+    const IOobject& io,
+    const scalarArray& points,
+    const std::vector<std::tuple<std::string, labelArray>>& cells,
+    const std::vector<std::tuple<std::string, labelArray, labelArray>>& boundaryPatches,
+    const std::string& defaultPatchName,
+    bool syncPar)
+{
+    pointField pts(pointsFromArray(points));
+
+    label nCells = 0;
+    for (const auto& [cell_type, nodes] : cells) {
+        const cellModel& model = cellModel::ref(Foam::word(cell_type));
+        if (nodes.ndim() != 2 || label(nodes.shape(1)) != model.nPoints()) {
+            throw std::runtime_error(
+                "Expected (nCells, " + std::to_string(model.nPoints())
+              + ") array for cell type " + cell_type);
+        }
+        const label* lab = nodes.data();
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (lab[i] < 0 || lab[i] >= pts.size()) {
+                throw std::runtime_error(
+                    "Point label " + std::to_string(lab[i]) + " out of range");
+            }
+        }
+        nCells += nodes.shape(0);
+    }
+
+    cellShapeList shapes(nCells);
+    label celli = 0;
+    for (const auto& [cell_type, nodes] : cells) {
+        const cellModel& model = cellModel::ref(Foam::word(cell_type));
+        const label nNodes = model.nPoints();
+        const label nTypeCells = nodes.shape(0);
+        const UList<label> flat(const_cast<label*>(nodes.data()), nodes.size());
+        const label start = celli;
+
+        nb::gil_scoped_release release;
+        parallel::parallelFor
+        (
+            nTypeCells,
+            [&](const label begin, const label end)
+            {
+                for (label i = begin; i < end; ++i)
+                {
+                    shapes[start + i].reset
+                    (
+                        model, SubList<label>(flat, nNodes, i*nNodes)
+                    );
+                }
+            }
+        );
+        celli += nTypeCells;
+    }
+
+    const label nPatches = boundaryPatches.size();
+    faceListList bFaces(nPatches);
+    wordList patchNames(nPatches);
+    wordList patchTypes(nPatches, polyPatch::typeName);
+
+    for (label patchi = 0; patchi < nPatches; ++patchi) {
+        const auto& [name, offsets, labels] = boundaryPatches[patchi];
+        patchNames[patchi] = Foam::word(name);
+        bFaces[patchi] = facesFromArrays(offsets, labels, pts.size());
+    }
+
+    wordList patchPhysicalTypes(nPatches, polyPatch::typeName);
+
+    new (self) polyMesh(
+        io,
+        std::move(pts),
+        shapes,
+        bFaces,
+        patchNames,
+        patchTypes,
+        Foam::word(defaultPatchName),
+        polyPatch::typeName,
+        patchPhysicalTypes,
+        syncPar
+    );
+}
+
 } // namespace Foam
 
 void Foam::bindPolyMesh(nanobind::module_ &m)
@@ -176,7 +395,8 @@ void Foam::bindPolyMesh(nanobind::module_ &m)
 
 
     // polyMesh bindings
-    nb::class_<Foam::polyMesh>(m, "polyMesh")
+    nb::class_<Foam::polyMesh> polyMeshClass(m, "polyMesh");
+    polyMeshClass
         // Constructor from OpenFOAM types (low-level)
         .def("__init__", &Foam::createPolyMesh,
              nb::arg("io"), nb::arg("points"), nb::arg("faces"),
@@ -193,6 +413,19 @@ void Foam::bindPolyMesh(nanobind::module_ &m)
              nb::arg("boundaryPatches"), nb::arg("defaultPatchName") = "defaultFaces",
              nb::arg("syncPar") = true,
              "Create polyMesh from cellShapes (handles face orientation automatically)")
+        // Constructors from NumPy arrays (bulk copies)
+        .def("__init__", &Foam::createPolyMeshFromArrays,
+             nb::arg("io"), nb::arg("points"), nb::arg("faceOffsets"),
+             nb::arg("facePoints"), nb::arg("owner"), nb::arg("neighbour"),
+             nb::arg("syncPar") = true,
+             "Create polyMesh from an (N, 3) points array, CSR faces\n"
+             "(faceOffsets, facePoints) and owner/neighbour arrays")
+        .def("__init__", &Foam::createPolyMeshFromCellArrays,
+             nb::arg("io"), nb::arg("points"), nb::arg("cells"),
+             nb::arg("boundaryPatches"), nb::arg("defaultPatchName") = "defaultFaces",
+             nb::arg("syncPar") = true,
+             "Create polyMesh from an (N, 3) points array, (type, (nCells, nNodes)\n"
+             "array) cell blocks and (name, faceOffsets, facePoints) patches")
         .def("write", [](Foam::polyMesh& self) { return self.write(); })
         .def("nCells", [](const Foam::polyMesh& self)
         {
@@ -234,6 +467,8 @@ void Foam::bindPolyMesh(nanobind::module_ &m)
             self.addPatches(patchList, validBoundary);
         }, nb::arg("patches"), nb::arg("validBoundary") = true);
 
+    Foam::bindMeshArrays(polyMeshClass);
+
     nb::class_<Foam::polyBoundaryMesh>(m, "polyBoundaryMesh")
         .def("size", [](const Foam::polyBoundaryMesh& self) { return self.size(); })
         .def("__len__", [](const Foam::polyBoundaryMesh& self) { return self.size(); })
@@ -38,6 +38,7 @@ Author
 #include "pointField.H"
 #include "faceList.H"
 #include "labelList.H"
+#include "bind_fields.hpp"
 #include <nanobind/stl/vector.h>
 #include <nanobind/stl/tuple.h>
 #include <nanobind/stl/string.h>
@@ -76,6 +77,30 @@ namespace Foam
         const std::string& defaultPatchName = "defaultFaces",
         bool syncPar = true);
 
+    // Array based overloads: points as (N, 3) float64, faces in CSR form
+    // (offsets of size nFaces + 1 and the flat point labels)
+
+    void createPolyMeshFromArrays(
+        polyMesh* self,
+        const IOobject& io,
+        const scalarArray& points,
+        const labelArray& faceOffsets,
+        const labelArray& facePoints,
+        const labelArray& owner,
+        const labelArray& neighbour,
+        bool syncPar = true);
+
+    // Cells as (nCells, nNodes) arrays per cell type, patches as
+    // (name, faceOffsets, facePoints)
+    void createPolyMeshFromCellArrays(
+        polyMesh* self,
+        const IOobject& io,
+        const scalarArray& points,
+        const std::vector<std::tuple<std::string, labelArray>>& cells,
+        const std::vector<std::tuple<std::string, labelArray, labelArray>>& boundaryPatches,
+        const std::string& defaultPatchName = "defaultFaces",
+        bool syncPar = true);
+
     // Main binding function
     void bindPolyMesh(nanobind::module_& m);
 }
@@ -0,0 +1,322 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "concurrentSolve.hpp"
+#include "parallelFor.hpp"
+#include "pythonSolver.hpp"
+#include "solveTelemetry.hpp"
+#include "GAMGAgglomeration.H"
+#include "volFields.H"
+
+#include <chrono>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+template<class Type>
+Foam::label Foam::fvMatrixSolveEntry<Type>::prepare()
+{
+    typedef GeometricField<Type, fvPatchField, volMesh> fieldType;
+
+    fieldType& psi = const_cast<fieldType&>(matrix_.psi());
+    const fvMesh& mesh = psi.mesh();
+
+    controls_ = &matrix_.solverDict();
+
+    bool coupled = false;
+    forAll(psi.boundaryField(), patchi)
+    {
+        coupled = coupled || psi.boundaryField()[patchi].coupled();
+    }
+
+    serial_ =
+        Pstream::parRun()
+     || (pTraits<Type>::nComponents > 1 && coupled);
+
+    if (serial_)
+    {
+        return 0;
+    }
+
+    // Demand-driven data shared by the solvers
+    const lduAddressing& addr = mesh.lduAddr();
+    addr.losortAddr();
+    addr.ownerStartAddr();
+    addr.losortStartAddr();
+
+    // GAMG, as solver or preconditioner, stores its agglomeration on the
+    // mesh on first use, which must not happen in the pool threads. The
+    // preconditioner gets the controls of lduMatrix::preconditioner::New.
+    if (controls_->getOrDefault<word>("solver", word::null) == "GAMG")
+    {
+        GAMGAgglomeration::New(matrix_, *controls_);
+    }
+    else if
+    (
+        const entry* eptr =
+            controls_->findEntry("preconditioner", keyType::LITERAL)
+    )
+    {
+        word preconditioner;
+        if (eptr->isDict())
+        {
+            eptr->dict().readEntry("preconditioner", preconditioner);
+        }
+        else
+        {
+            eptr->stream() >> preconditioner;
+        }
+
+        if (preconditioner == "GAMG")
+        {
+            GAMGAgglomeration::New
+            (
+                matrix_,
+                eptr->isDict() ? eptr->dict() : dictionary::null
+            );
+        }
+    }
+
+    psiField_ = &psi.primitiveField();
+    interfaces_ = psi.boundaryField().scalarInterfaces();
+
+    cmpts_.clear();
+    if constexpr (pTraits<Type>::nComponents == 1)
+    {
+        cmpts_.push_back(0);
+    }
+    else
+    {
+        const typename pTraits<Type>::labelType validComponents
+        (
+            mesh.template validComponents<Type>()
+        );
+
+        for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; ++cmpt)
+        {
+            if (component(validComponents, cmpt) != -1)
+            {
+                cmpts_.push_back(cmpt);
+            }
+        }
+    }
+
+    cmptPsi_.assign(cmpts_.size(), scalarField());
+    cmptPerf_.assign(cmpts_.size(), SolverPerformance<scalar>());
+    cmptTime_.assign(cmpts_.size(), 0.0);
+
+    return label(cmpts_.size());
+}
+
+
+template<class Type>
+void Foam::fvMatrixSolveEntry<Type>::solveJob(const label jobi)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    const direction cmpt = cmpts_[jobi];
+    const fvMatrix<Type>& matrix = matrix_;
+    const auto& bPsi = matrix.psi().boundaryField();
+
+    // Same system as fvMatrix::solveSegregated for this component
+    lduMatrix A(matrix);
+
+    scalarField& diag = A.diag();
+    scalarField source(matrix.source().component(cmpt));
+    forAll(bPsi, patchi)
+    {
+        const labelUList& faceCells = matrix.lduAddr().patchAddr(patchi);
+        const Field<Type>& intCoeffs = matrix.internalCoeffs()[patchi];
+        forAll(faceCells, i)
+        {
+            diag[faceCells[i]] += component(intCoeffs[i], cmpt);
+        }
+
+        if (!bPsi[patchi].coupled())
+        {
+            const Field<Type>& bouCoeffs = matrix.boundaryCoeffs()[patchi];
+            forAll(faceCells, i)
+            {
+                source[faceCells[i]] += component(bouCoeffs[i], cmpt);
+            }
+        }
+    }
+
+    FieldField<Field, scalar> bouCoeffs
+    (
+        matrix.boundaryCoeffs().component(cmpt)
+    );
+    FieldField<Field, scalar> intCoeffs
+    (
+        matrix.internalCoeffs().component(cmpt)
+    );
+
+    scalarField& psiCmpt = cmptPsi_[jobi];
+    psiCmpt = psiField_->component(cmpt);
+
+    const word name =
+        pTraits<Type>::nComponents == 1
+      ? matrix.psi().name()
+      : word(matrix.psi().name() + pTraits<Type>::componentNames[cmpt]);
+
+    cmptPerf_[jobi] = lduMatrix::solver::New
+    (
+        name,
+        A,
+        bouCoeffs,
+        intCoeffs,
+        interfaces_,
+        *controls_
+    )->solve(psiCmpt, source, cmpt);
+
+    const std::chrono::duration<double> wallTime =
+        std::chrono::steady_clock::now() - start;
+    cmptTime_[jobi] = wallTime.count();
+}
+
+
+template<class Type>
+void Foam::fvMatrixSolveEntry<Type>::finish()
+{
+    typedef GeometricField<Type, fvPatchField, volMesh> fieldType;
+
+    fieldType& psi = const_cast<fieldType&>(matrix_.psi());
+    const fvMesh& mesh = psi.mesh();
+
+    if (serial_)
+    {
+        perf_ = recordSolve(matrix_, [this]
+        {
+            return restoreDiagOnError
+            (
+                matrix_, matrix_.solverDict(), [this]{ return matrix_.solve(); }
+            );
+        });
+        return;
+    }
+
+    Field<Type>& psiField = psi.primitiveFieldRef();
+    for (size_t i = 0; i < cmpts_.size(); ++i)
+    {
+        psiField.replace(cmpts_[i], cmptPsi_[i]);
+    }
+    cmptPsi_.clear();
+
+    psi.correctBoundaryConditions();
+
+    if constexpr (std::is_same<Type, scalar>::value)
+    {
+        perf_ = cmptPerf_[0];
+    }
+    else
+    {
+        perf_ = SolverPerformance<Type>
+        (
+            cmptPerf_.empty() ? word::null : cmptPerf_[0].solverName(),
+            psi.name()
+        );
+        for (size_t i = 0; i < cmpts_.size(); ++i)
+        {
+            perf_.replace(cmpts_[i], cmptPerf_[i]);
+        }
+    }
+
+    if (SolverPerformance<Type>::debug)
+    {
+        for (const SolverPerformance<scalar>& perf : cmptPerf_)
+        {
+            perf.print(Info.masterStream(mesh.comm()));
+        }
+    }
+
+    #if OPENFOAM >= 2312
+        mesh.data().setSolverPerformance(psi.name(), perf_);
+    #else
+        mesh.setSolverPerformance(psi.name(), perf_);
+    #endif
+
+    solveTelemetry& telemetry = solveTelemetry::instance();
+    if (telemetry.enabled())
+    {
+        // Summed over the components, as for a segregated solve
+        telemetry.add
+        (
+            perf_,
+            mesh.time().value(),
+            std::accumulate(cmptTime_.begin(), cmptTime_.end(), 0.0)
+        );
+    }
+}
+
+
+void Foam::concurrentSolve::solve()
+{
+    std::set<const void*> fields;
+    for (const auto& entry : entries_)
+    {
+        if (!fields.insert(entry->psi()).second)
+        {
+            throw std::runtime_error
+            (
+                "solve_all: two matrices solve for the same field"
+            );
+        }
+    }
+
+    // Serial set-up, then one flat job list over all matrices
+    std::vector<std::pair<concurrentSolveEntry*, label>> jobs;
+    for (const auto& entry : entries_)
+    {
+        const label nJobs = entry->prepare();
+        for (label jobi = 0; jobi < nJobs; ++jobi)
+        {
+            jobs.emplace_back(entry.get(), jobi);
+        }
+    }
+
+    // A throwing job skips finish(): psi is not written before it
+    parallel::threadPool::instance().run
+    (
+        label(jobs.size()),
+        [&jobs](const label i)
+        {
+            jobs[i].first->solveJob(jobs[i].second);
+        }
+    );
+
+    for (const auto& entry : entries_)
+    {
+        entry->finish();
+    }
+}
+
+
+// * * * * * * * * * * * * * Explicit Instantiations * * * * * * * * * * * * //
+
+template class Foam::fvMatrixSolveEntry<Foam::scalar>;
+template class Foam::fvMatrixSolveEntry<Foam::vector>;
+template class Foam::fvMatrixSolveEntry<Foam::symmTensor>;
+template class Foam::fvMatrixSolveEntry<Foam::tensor>;
+
+
+// ************************************************************************* //
@@ -0,0 +1,179 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::concurrentSolve
+
+Description
+    Solve several independent fvMatrix systems, and the components of
+    segregated vector/tensor matrices, on the thread pool.
+
+    fvMatrix::solve() updates shared state (the solver performance
+    dictionary of the mesh, demand-driven addressing, the GAMG
+    agglomeration), so it cannot run concurrently as is. The solve is split
+    like fvMatrix::solveSegregated:
+
+      - prepare (serial): look up the solver controls, build the lduMatrix
+        addressing and the GAMG agglomeration, get write access to psi
+      - one job per component (threaded): solve a copy of the matrix with
+        the boundary diagonal and source added, into a copy of the component
+      - finish (serial): write the solved components to psi, correct the
+        boundary conditions, store and print the solver performance
+
+    The matrices are never modified and psi only in finish(), so if a job
+    throws, all fields are left as they were before the call.
+
+    Coupled interfaces are only handled for scalar matrices. Vector/tensor
+    matrices on meshes with coupled patches, and all matrices in parallel
+    runs (MPI from several threads), are solved with fvMatrix::solve() in
+    the serial phase.
+
+SourceFiles
+    concurrentSolve.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_concurrentSolve
+#define foam_concurrentSolve
+
+#include "fvMatrix.H"
+#include "lduMatrix.H"
+
+#include <memory>
+#include <vector>
+
+namespace Foam
+{
+
+//- One matrix of a concurrentSolve
+class concurrentSolveEntry
+{
+public:
+
+    virtual ~concurrentSolveEntry() = default;
+
+    //- The solved field, which must differ between entries
+    virtual const void* psi() const = 0;
+
+    //- Serial set-up, returns the number of threaded jobs
+    virtual label prepare() = 0;
+
+    //- Threaded solve of job jobi
+    virtual void solveJob(const label jobi) = 0;
+
+    //- Serial completion
+    virtual void finish() = 0;
+};
+
+
+template<class Type>
+class fvMatrixSolveEntry
+:
+    public concurrentSolveEntry
+{
+    // Private Data
+
+        fvMatrix<Type>& matrix_;
+
+        const dictionary* controls_;
+
+        //- Solved by fvMatrix::solve() in finish()
+        bool serial_;
+
+        //- Values of psi, taken in prepare()
+        const Field<Type>* psiField_;
+
+        lduInterfaceFieldPtrsList interfaces_;
+
+        //- Solved components
+        std::vector<direction> cmpts_;
+
+        //- Solution of each component, written to psi in finish()
+        std::vector<scalarField> cmptPsi_;
+
+        std::vector<SolverPerformance<scalar>> cmptPerf_;
+
+        //- Wall time of the component solves
+        std::vector<double> cmptTime_;
+
+        SolverPerformance<Type> perf_;
+
+
+public:
+
+    // Constructors
+
+        explicit fvMatrixSolveEntry(fvMatrix<Type>& matrix)
+        :
+            matrix_(matrix),
+            controls_(nullptr),
+            serial_(false),
+            psiField_(nullptr),
+            interfaces_(),
+            cmpts_(),
+            cmptPsi_(),
+            cmptPerf_(),
+            cmptTime_(),
+            perf_()
+        {}
+
+
+    // Member Functions
+
+        const void* psi() const
+        {
+            return &matrix_.psi();
+        }
+
+        const SolverPerformance<Type>& performance() const noexcept
+        {
+            return perf_;
+        }
+
+        label prepare();
+
+        void solveJob(const label jobi);
+
+        void finish();
+};
+
+
+class concurrentSolve
+{
+    // Private Data
+
+        std::vector<std::unique_ptr<concurrentSolveEntry>> entries_;
+
+
+public:
+
+    //- Add a matrix, returns its entry for the result
+    template<class Type>
+    const fvMatrixSolveEntry<Type>& add(fvMatrix<Type>& matrix)
+    {
+        auto* entry = new fvMatrixSolveEntry<Type>(matrix);
+        entries_.emplace_back(entry);
+        return *entry;
+    }
+
+    //- Solve all matrices
+    void solve();
+};
+
+} // End namespace Foam
+
+#endif
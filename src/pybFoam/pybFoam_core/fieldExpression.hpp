@@ -0,0 +1,455 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::fieldExpression
+
+Description
+    Lazily evaluated arithmetic on scalar and vector fields.
+
+    The Python operators of Field<Type> return a new tmp<Field<Type>> for
+    every operation, so an expression like (a*b + c)/(a + 1) streams the
+    whole field through memory once per operator. A fieldExpression only
+    records the operation tree; evaluation walks the fields once in blocks
+    of blockSize elements, keeping every intermediate result in a small
+    stack buffer.
+
+    Elements are stored array-of-structures, i.e. a vector node produces
+    3 consecutive scalars per element, matching the layout of Field<vector>.
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_fieldExpression
+#define foam_fieldExpression
+
+#include "Field.H"
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace Foam
+{
+namespace fieldExpr
+{
+
+//- Elements evaluated per block. Small enough that the scratch buffers of
+//  a deep expression tree stay in cache.
+constexpr label blockSize = 256;
+
+//- Largest number of components per element (vector)
+constexpr direction maxComps = 3;
+
+enum class operation { add, subtract, multiply, divide };
+
+
+class node
+{
+public:
+
+    virtual ~node() = default;
+
+    //- Number of scalar components per element (1: scalar, 3: vector)
+    virtual direction nComps() const = 0;
+
+    //- Number of elements or -1 for a uniform value
+    virtual label size() const = 0;
+
+    //- Evaluate the elements [start, start + n). The result is either
+    //  written to buf (n*nComps() scalars) or points into leaf storage.
+    virtual const scalar* evaluate
+    (
+        const label start,
+        const label n,
+        scalar* buf
+    ) const = 0;
+};
+
+
+template<class Type>
+class fieldNode
+:
+    public node
+{
+    const UList<Type>& field_;
+
+public:
+
+    explicit fieldNode(const UList<Type>& field)
+    :
+        field_(field)
+    {}
+
+    direction nComps() const override
+    {
+        return pTraits<Type>::nComponents;
+    }
+
+    label size() const override
+    {
+        return field_.size();
+    }
+
+    const scalar* evaluate(const label start, const label, scalar*) const override
+    {
+        return reinterpret_cast<const scalar*>(field_.cdata()) + start*nComps();
+    }
+};
+
+
+template<class Type>
+class uniformNode
+:
+    public node
+{
+    const Type value_;
+
+public:
+
+    explicit uniformNode(const Type& value)
+    :
+        value_(value)
+    {}
+
+    direction nComps() const override
+    {
+        return pTraits<Type>::nComponents;
+    }
+
+    label size() const override
+    {
+        return -1;
+    }
+
+    const scalar* evaluate(const label, const label n, scalar* buf) const override
+    {
+        const direction nc = nComps();
+        const scalar* v = reinterpret_cast<const scalar*>(&value_);
+        for (label i = 0; i < n; ++i)
+        {
+            for (direction c = 0; c < nc; ++c)
+            {
+                buf[i*nc + c] = v[c];
+            }
+        }
+        return buf;
+    }
+};
+
+
+class negateNode
+:
+    public node
+{
+    const std::shared_ptr<const node> arg_;
+
+public:
+
+    explicit negateNode(std::shared_ptr<const node> arg)
+    :
+        arg_(std::move(arg))
+    {}
+
+    direction nComps() const override
+    {
+        return arg_->nComps();
+    }
+
+    label size() const override
+    {
+        return arg_->size();
+    }
+
+    const scalar* evaluate(const label start, const label n, scalar* buf) const override
+    {
+        const scalar* a = arg_->evaluate(start, n, buf);
+        const label len = n*nComps();
+        for (label i = 0; i < len; ++i)
+        {
+            buf[i] = -a[i];
+        }
+        return buf;
+    }
+};
+
+
+class binaryNode
+:
+    public node
+{
+    const operation op_;
+    const std::shared_ptr<const node> lhs_;
+    const std::shared_ptr<const node> rhs_;
+    direction nComps_;
+    label size_;
+
+public:
+
+    binaryNode
+    (
+        const operation op,
+        std::shared_ptr<const node> lhs,
+        std::shared_ptr<const node> rhs
+    )
+    :
+        op_(op),
+        lhs_(std::move(lhs)),
+        rhs_(std::move(rhs)),
+        nComps_(std::max(lhs_->nComps(), rhs_->nComps())),
+        size_(std::max(lhs_->size(), rhs_->size()))
+    {
+        const label nl = lhs_->size();
+        const label nr = rhs_->size();
+        if (nl != -1 && nr != -1 && nl != nr)
+        {
+            throw std::runtime_error
+            (
+                "Field sizes do not match in expression: "
+              + std::to_string(nl) + " vs " + std::to_string(nr)
+            );
+        }
+    }
+
+    direction nComps() const override
+    {
+        return nComps_;
+    }
+
+    label size() const override
+    {
+        return size_;
+    }
+
+    const scalar* evaluate(const label start, const label n, scalar* buf) const override
+    {
+        const direction na = lhs_->nComps();
+        const direction nb = rhs_->nComps();
+
+        // A scalar lhs broadcast onto a vector result must not share the
+        // result buffer: writing element i would clobber lhs entries > i
+        scalar lbuf[maxComps*blockSize];
+        scalar rbuf[maxComps*blockSize];
+        const scalar* a = lhs_->evaluate(start, n, na < nComps_ ? lbuf : buf);
+        const scalar* b = rhs_->evaluate(start, n, rbuf);
+
+        if (na == nb)
+        {
+            const label len = n*na;
+            switch (op_)
+            {
+                case operation::add:
+                    for (label i = 0; i < len; ++i) buf[i] = a[i] + b[i];
+                    break;
+                case operation::subtract:
+                    for (label i = 0; i < len; ++i) buf[i] = a[i] - b[i];
+                    break;
+                case operation::multiply:
+                    for (label i = 0; i < len; ++i) buf[i] = a[i]*b[i];
+                    break;
+                case operation::divide:
+                    for (label i = 0; i < len; ++i) buf[i] = a[i]/b[i];
+                    break;
+            }
+        }
+        else if (nb == 1)
+        {
+            // Type (*|/) scalar
+            for (label i = 0; i < n; ++i)
+            {
+                const scalar s = op_ == operation::divide ? 1.0/b[i] : b[i];
+                for (direction c = 0; c < na; ++c)
+                {
+                    buf[i*na + c] = a[i*na + c]*s;
+                }
+            }
+        }
+        else
+        {
+            // scalar * Type
+            for (label i = 0; i < n; ++i)
+            {
+                for (direction c = 0; c < nb; ++c)
+                {
+                    buf[i*nb + c] = a[i]*b[i*nb + c];
+                }
+            }
+        }
+        return buf;
+    }
+};
+
+} // End namespace fieldExpr
+
+
+template<class Type>
+class fieldExpression
+{
+    std::shared_ptr<const fieldExpr::node> node_;
+
+public:
+
+    explicit fieldExpression(std::shared_ptr<const fieldExpr::node> n)
+    :
+        node_(std::move(n))
+    {}
+
+    static fieldExpression<Type> field(const UList<Type>& f)
+    {
+        return fieldExpression<Type>
+        (
+            std::make_shared<fieldExpr::fieldNode<Type>>(f)
+        );
+    }
+
+    static fieldExpression<Type> uniform(const Type& value)
+    {
+        return fieldExpression<Type>
+        (
+            std::make_shared<fieldExpr::uniformNode<Type>>(value)
+        );
+    }
+
+    const std::shared_ptr<const fieldExpr::node>& node() const
+    {
+        return node_;
+    }
+
+    //- Number of elements; throws if the expression has no field operand
+    label size() const
+    {
+        const label n = node_->size();
+        if (n < 0)
+        {
+            throw std::runtime_error
+            (
+                "Expression contains no field operand"
+            );
+        }
+        return n;
+    }
+
+    //- Evaluate into existing storage of the same size. The result may
+    //  alias any operand since every block is fully read before written.
+    void evaluate(UList<Type>& result) const
+    {
+        const label n = size();
+        if (n != result.size())
+        {
+            throw std::runtime_error
+            (
+                "Cannot assign expression of size " + std::to_string(n)
+              + " to field of size " + std::to_string(result.size())
+            );
+        }
+
+        constexpr direction nc = pTraits<Type>::nComponents;
+        scalar* dst = reinterpret_cast<scalar*>(result.data());
+        scalar buf[fieldExpr::maxComps*fieldExpr::blockSize];
+
+        for (label start = 0; start < n; start += fieldExpr::blockSize)
+        {
+            const label len = std::min(fieldExpr::blockSize, n - start);
+            const scalar* r = node_->evaluate(start, len, buf);
+            std::copy(r, r + len*nc, dst + start*nc);
+        }
+    }
+
+    //- Evaluate into a new field
+    Field<Type> evaluate() const
+    {
+        Field<Type> result(size());
+        evaluate(result);
+        return result;
+    }
+
+    fieldExpression<Type> operator-() const
+    {
+        return fieldExpression<Type>
+        (
+            std::make_shared<fieldExpr::negateNode>(node_)
+        );
+    }
+};
+
+
+template<class Result, class Type1, class Type2>
+fieldExpression<Result> binaryExpression
+(
+    const fieldExpr::operation op,
+    const fieldExpression<Type1>& lhs,
+    const fieldExpression<Type2>& rhs
+)
+{
+    return fieldExpression<Result>
+    (
+        std::make_shared<fieldExpr::binaryNode>(op, lhs.node(), rhs.node())
+    );
+}
+
+
+template<class Type>
+fieldExpression<Type> operator+
+(
+    const fieldExpression<Type>& lhs,
+    const fieldExpression<Type>& rhs
+)
+{
+    return binaryExpression<Type>(fieldExpr::operation::add, lhs, rhs);
+}
+
+template<class Type>
+fieldExpression<Type> operator-
+(
+    const fieldExpression<Type>& lhs,
+    const fieldExpression<Type>& rhs
+)
+{
+    return binaryExpression<Type>(fieldExpr::operation::subtract, lhs, rhs);
+}
+
+template<class Type>
+fieldExpression<Type> operator*
+(
+    const fieldExpression<Type>& lhs,
+    const fieldExpression<scalar>& rhs
+)
+{
+    return binaryExpression<Type>(fieldExpr::operation::multiply, lhs, rhs);
+}
+
+inline fieldExpression<vector> operator*
+(
+    const fieldExpression<scalar>& lhs,
+    const fieldExpression<vector>& rhs
+)
+{
+    return binaryExpression<vector>(fieldExpr::operation::multiply, lhs, rhs);
+}
+
+template<class Type>
+fieldExpression<Type> operator/
+(
+    const fieldExpression<Type>& lhs,
+    const fieldExpression<scalar>& rhs
+)
+{
+    return binaryExpression<Type>(fieldExpr::operation::divide, lhs, rhs);
+}
+
+} // End namespace Foam
+
+#endif
@@ -0,0 +1,235 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+InNamespace
+    Foam::fieldIntegrals
+
+Description
+    Weighted sums of geometric fields for domainIntegrate, weightedAverage
+    and the patch and cellZone integrals of the bindings.
+
+    The weighted sum and the sum of the weights (cell volumes or face
+    areas) are accumulated in one pass, split over the thread pool
+    (parallelFor.hpp). All sums of a call are packed into one scalarField
+    and summed over the processors with a single reduce.
+
+    Patch integrals cover the non-processor patches only: those exist with
+    the same index on every processor, so every rank takes part in the
+    same reductions and rejects the same names.
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_fieldIntegrals
+#define foam_fieldIntegrals
+
+#include <stdexcept>
+#include <string>
+
+#include "parallelFor.hpp"
+#include "patchIndexTable.hpp"
+#include "volFields.H"
+#include "surfaceFields.H"
+#include "PstreamReduceOps.H"
+
+namespace Foam
+{
+namespace fieldIntegrals
+{
+
+//- Sum of weight*value and sum of the weights
+template<class Type>
+struct weightedSum
+{
+    Type sum = Zero;
+    scalar weight = 0;
+
+    weightedSum() = default;
+
+    weightedSum(const zero)
+    {}
+
+    void operator+=(const weightedSum& s)
+    {
+        sum += s.sum;
+        weight += s.weight;
+    }
+
+    //- sum/weight, zero without weight
+    Type average() const
+    {
+        return weight > VSMALL ? sum/weight : Type(Zero);
+    }
+};
+
+
+//- Weighted sum of f[addr[i]] (all of f without addr), threaded
+template<class Type>
+weightedSum<Type> sumWeighted
+(
+    const UList<Type>& f,
+    const UList<scalar>& w,
+    const labelUList* addr = nullptr
+)
+{
+    const label n = addr ? addr->size() : f.size();
+
+    return parallel::parallelSum<weightedSum<Type>>
+    (
+        n,
+        [&](const label start, const label end)
+        {
+            weightedSum<Type> s;
+            for (label i = start; i < end; ++i)
+            {
+                const label j = addr ? (*addr)[i] : i;
+                s.sum += w[j]*f[j];
+                s.weight += w[j];
+            }
+            return s;
+        }
+    );
+}
+
+
+//- Sum over the processors, one reduction for all entries
+template<class Type>
+void reduce(UList<weightedSum<Type>>& sums)
+{
+    if (!Pstream::parRun())
+    {
+        return;
+    }
+
+    constexpr direction nCmpt = pTraits<Type>::nComponents;
+
+    scalarField values(sums.size()*(nCmpt + 1));
+    forAll(sums, i)
+    {
+        scalar* v = &values[i*(nCmpt + 1)];
+        for (direction d = 0; d < nCmpt; ++d)
+        {
+            v[d] = component(sums[i].sum, d);
+        }
+        v[nCmpt] = sums[i].weight;
+    }
+
+    Foam::reduce(values, sumOp<scalarField>());
+
+    forAll(sums, i)
+    {
+        const scalar* v = &values[i*(nCmpt + 1)];
+        for (direction d = 0; d < nCmpt; ++d)
+        {
+            setComponent(sums[i].sum, d) = v[d];
+        }
+        sums[i].weight = v[nCmpt];
+    }
+}
+
+
+//- Volume weighted sum of the internal field
+template<class Type>
+weightedSum<Type> domain(const GeometricField<Type, fvPatchField, volMesh>& vf)
+{
+    weightedSum<Type> s = sumWeighted<Type>(vf.primitiveField(), vf.mesh().V());
+    UList<weightedSum<Type>> sums(&s, 1);
+    reduce(sums);
+    return s;
+}
+
+
+//- Volume weighted sum over the cells of a cellZone
+template<class Type>
+weightedSum<Type> cellZone
+(
+    const GeometricField<Type, fvPatchField, volMesh>& vf,
+    const word& zoneName
+)
+{
+    const fvMesh& mesh = vf.mesh();
+    const label zonei = mesh.cellZones().findZoneID(zoneName);
+    if (zonei < 0)
+    {
+        throw std::runtime_error("No cellZone named " + zoneName);
+    }
+
+    const labelUList& cells = mesh.cellZones()[zonei];
+    weightedSum<Type> s =
+        sumWeighted<Type>(vf.primitiveField(), mesh.V(), &cells);
+    UList<weightedSum<Type>> sums(&s, 1);
+    reduce(sums);
+    return s;
+}
+
+
+//- Index of a non-processor patch, throws std::runtime_error for unknown
+//  and processor patches (on every rank alike)
+inline label patchIndex(const polyMesh& mesh, const word& patchName)
+{
+    const label patchi = patchIndexTable::New(mesh).find(patchName);
+    if (patchi < 0 || patchi >= mesh.boundaryMesh().nNonProcessor())
+    {
+        throw std::runtime_error
+        (
+            "not a non-processor patch: " + patchName
+        );
+    }
+    return patchi;
+}
+
+
+//- Area weighted sum of the values on one patch
+template<class Type, template<class> class PatchField, class GeoMesh>
+weightedSum<Type> patch
+(
+    const GeometricField<Type, PatchField, GeoMesh>& f,
+    const label patchi
+)
+{
+    weightedSum<Type> s = sumWeighted<Type>
+    (
+        f.boundaryField()[patchi],
+        f.mesh().magSf().boundaryField()[patchi]
+    );
+    UList<weightedSum<Type>> sums(&s, 1);
+    reduce(sums);
+    return s;
+}
+
+
+//- Area weighted sums of the values on every non-processor patch
+template<class Type, template<class> class PatchField, class GeoMesh>
+List<weightedSum<Type>> patches
+(
+    const GeometricField<Type, PatchField, GeoMesh>& f
+)
+{
+    const surfaceScalarField::Boundary& magSf = f.mesh().magSf().boundaryField();
+
+    List<weightedSum<Type>> sums(f.mesh().boundaryMesh().nNonProcessor());
+    forAll(sums, patchi)
+    {
+        sums[patchi] = sumWeighted<Type>(f.boundaryField()[patchi], magSf[patchi]);
+    }
+    reduce(sums);
+    return sums;
+}
+
+} // End namespace fieldIntegrals
+} // End namespace Foam
+
+#endif
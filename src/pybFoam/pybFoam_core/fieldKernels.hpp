@@ -0,0 +1,467 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+    Element-wise Field and GeometricField kernels for the bindings.
+
+    The result is allocated while holding the GIL, the loops run with the
+    GIL released and are split over the thread pool (parallelFor.hpp).
+    Boundary values of geometric fields are evaluated serially since they
+    are small compared to the internal field.
+
+    Ops with a simdKernel specialisation run each chunk through the
+    runtime-dispatched AVX2/AVX-512 loops of simdKernels.hpp.
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_fieldKernels
+#define foam_fieldKernels
+
+#include <nanobind/nanobind.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "parallelFor.hpp"
+#include "simdKernels.hpp"
+#include "Field.H"
+#include "tensor.H"
+#include "symmTensor.H"
+#include "GeometricField.H"
+#include "tmp.H"
+#include "PstreamReduceOps.H"
+
+namespace nb = nanobind;
+
+namespace Foam
+{
+namespace kernels
+{
+
+struct addOp
+{
+    template<class A, class B>
+    auto operator()(const A& a, const B& b) const { return a + b; }
+};
+
+struct subtractOp
+{
+    template<class A, class B>
+    auto operator()(const A& a, const B& b) const { return a - b; }
+};
+
+struct multiplyOp
+{
+    template<class A, class B>
+    auto operator()(const A& a, const B& b) const { return a*b; }
+};
+
+struct divideOp
+{
+    template<class A, class B>
+    auto operator()(const A& a, const B& b) const { return a/b; }
+};
+
+struct innerOp
+{
+    template<class A, class B>
+    auto operator()(const A& a, const B& b) const { return a & b; }
+};
+
+struct doubleInnerOp
+{
+    template<class A, class B>
+    auto operator()(const A& a, const B& b) const { return a && b; }
+};
+
+struct magOp
+{
+    template<class A>
+    scalar operator()(const A& a) const { return Foam::mag(a); }
+};
+
+struct magSqrOp
+{
+    template<class A>
+    scalar operator()(const A& a) const { return Foam::magSqr(a); }
+};
+
+struct symmOp
+{
+    template<class A>
+    auto operator()(const A& a) const { return Foam::symm(a); }
+};
+
+struct dev2Op
+{
+    template<class A>
+    auto operator()(const A& a) const { return Foam::dev2(a); }
+};
+
+//- op(a, b) with a uniform second operand
+template<class Op, class Type>
+struct uniformOp
+{
+    Op op;
+    Type b;
+
+    template<class A>
+    auto operator()(const A& a) const { return op(a, b); }
+};
+
+
+//- SIMD implementation of Op for the given result and argument types.
+//  Without a specialisation transform() runs the plain loop.
+template<class Op, class Result, class... Args>
+struct simdKernel
+{
+    static constexpr bool available = false;
+};
+
+#define makeSimdKernel1(Op, Result, Type, func)                                \
+    template<>                                                                 \
+    struct simdKernel<Op, Result, Type>                                        \
+    {                                                                          \
+        static constexpr bool available = true;                                \
+        static void apply                                                      \
+        (                                                                      \
+            const Op&, Result* r, const Type* a, const label n                 \
+        )                                                                      \
+        {                                                                      \
+            simd::func                                                         \
+            (                                                                  \
+                reinterpret_cast<const scalar*>(a),                            \
+                reinterpret_cast<scalar*>(r),                                  \
+                n                                                              \
+            );                                                                 \
+        }                                                                      \
+    };
+
+#define makeSimdKernel2(Op, Result, Type1, Type2, func)                        \
+    template<>                                                                 \
+    struct simdKernel<Op, Result, Type1, Type2>                                \
+    {                                                                          \
+        static constexpr bool available = true;                                \
+        static void apply                                                      \
+        (                                                                      \
+            const Op&,                                                         \
+            Result* r,                                                         \
+            const Type1* a,                                                    \
+            const Type2* b,                                                    \
+            const label n                                                      \
+        )                                                                      \
+        {                                                                      \
+            simd::func                                                         \
+            (                                                                  \
+                reinterpret_cast<const scalar*>(a),                            \
+                reinterpret_cast<const scalar*>(b),                            \
+                reinterpret_cast<scalar*>(r),                                  \
+                n                                                              \
+            );                                                                 \
+        }                                                                      \
+    };
+
+makeSimdKernel1(magSqrOp, scalar, vector, magSqrVector)
+makeSimdKernel1(magOp, scalar, vector, magVector)
+makeSimdKernel1(magSqrOp, scalar, tensor, magSqrTensor)
+makeSimdKernel1(magOp, scalar, tensor, magTensor)
+makeSimdKernel1(symmOp, symmTensor, tensor, symmTensorOfTensor)
+makeSimdKernel1(dev2Op, tensor, tensor, dev2Tensor)
+makeSimdKernel1(dev2Op, symmTensor, symmTensor, dev2SymmTensor)
+
+makeSimdKernel2(innerOp, scalar, vector, vector, inner)
+makeSimdKernel2(multiplyOp, vector, vector, scalar, multiplyVector)
+makeSimdKernel2(divideOp, vector, vector, scalar, divideVector)
+makeSimdKernel2(doubleInnerOp, scalar, tensor, symmTensor, doubleInner)
+
+#undef makeSimdKernel1
+#undef makeSimdKernel2
+
+template<>
+struct simdKernel<uniformOp<innerOp, vector>, scalar, vector>
+{
+    static constexpr bool available = true;
+    static void apply
+    (
+        const uniformOp<innerOp, vector>& op,
+        scalar* r,
+        const vector* a,
+        const label n
+    )
+    {
+        simd::innerUniform
+        (
+            reinterpret_cast<const scalar*>(a),
+            op.b.cdata(),
+            r,
+            n
+        );
+    }
+};
+
+
+inline void checkSizes(const label n1, const label n2)
+{
+    if (n1 != n2)
+    {
+        throw std::runtime_error
+        (
+            "Field sizes do not match: "
+          + std::to_string(n1) + " vs " + std::to_string(n2)
+        );
+    }
+}
+
+
+//- result[i] = op(f[i]). result may alias f.
+template<class Result, class Type, class Op>
+void transform(UList<Result>& result, const UList<Type>& f, const Op& op)
+{
+    checkSizes(result.size(), f.size());
+    Result* r = result.data();
+    const Type* a = f.cdata();
+
+    parallel::parallelFor
+    (
+        f.size(),
+        [&](const label start, const label end)
+        {
+            if constexpr (simdKernel<Op, Result, Type>::available)
+            {
+                simdKernel<Op, Result, Type>::apply
+                (
+                    op, r + start, a + start, end - start
+                );
+            }
+            else
+            {
+                for (label i = start; i < end; ++i)
+                {
+                    r[i] = op(a[i]);
+                }
+            }
+        }
+    );
+}
+
+
+//- result[i] = op(f1[i], f2[i]). result may alias f1 or f2.
+template<class Result, class Type1, class Type2, class Op>
+void transform
+(
+    UList<Result>& result,
+    const UList<Type1>& f1,
+    const UList<Type2>& f2,
+    const Op& op
+)
+{
+    checkSizes(f1.size(), f2.size());
+    checkSizes(result.size(), f1.size());
+    Result* r = result.data();
+    const Type1* a = f1.cdata();
+    const Type2* b = f2.cdata();
+
+    parallel::parallelFor
+    (
+        f1.size(),
+        [&](const label start, const label end)
+        {
+            if constexpr (simdKernel<Op, Result, Type1, Type2>::available)
+            {
+                simdKernel<Op, Result, Type1, Type2>::apply
+                (
+                    op, r + start, a + start, b + start, end - start
+                );
+            }
+            else
+            {
+                for (label i = start; i < end; ++i)
+                {
+                    r[i] = op(a[i], b[i]);
+                }
+            }
+        }
+    );
+}
+
+
+template<class Result, class Type, class Op>
+tmp<Field<Result>> unary(const UList<Type>& f, const Op& op)
+{
+    tmp<Field<Result>> tres(new Field<Result>(f.size()));
+    Field<Result>& res = tres.ref();
+
+    nb::gil_scoped_release release;
+    transform(res, f, op);
+    return tres;
+}
+
+
+template<class Result, class Type1, class Type2, class Op>
+tmp<Field<Result>> binary
+(
+    const UList<Type1>& f1,
+    const UList<Type2>& f2,
+    const Op& op
+)
+{
+    checkSizes(f1.size(), f2.size());
+    tmp<Field<Result>> tres(new Field<Result>(f1.size()));
+    Field<Result>& res = tres.ref();
+
+    nb::gil_scoped_release release;
+    transform(res, f1, f2, op);
+    return tres;
+}
+
+
+//- f[i] = op(f[i], f2[i])
+template<class Type, class Type2, class Op>
+void inplace(UList<Type>& f, const UList<Type2>& f2, const Op& op)
+{
+    nb::gil_scoped_release release;
+    transform(f, f, f2, op);
+}
+
+
+//- f[i] = op(f[i])
+template<class Type, class Op>
+void inplace(UList<Type>& f, const Op& op)
+{
+    nb::gil_scoped_release release;
+    transform(f, f, op);
+}
+
+
+//- Global sum over all processors
+template<class Type>
+Type sum(const UList<Type>& f)
+{
+    Type result(Zero);
+    {
+        nb::gil_scoped_release release;
+        const Type* a = f.cdata();
+
+        result = parallel::parallelSum<Type>
+        (
+            f.size(),
+            [&](const label start, const label end)
+            {
+                Type s(Zero);
+                for (label i = start; i < end; ++i)
+                {
+                    s += a[i];
+                }
+                return s;
+            }
+        );
+    }
+
+    reduce(result, sumOp<Type>());
+    return result;
+}
+
+
+//- Geometric field named name with values op(gf)
+template
+<
+    class Result, class Type,
+    template<class> class PatchField, class GeoMesh, class Op
+>
+tmp<GeometricField<Result, PatchField, GeoMesh>> unary
+(
+    const GeometricField<Type, PatchField, GeoMesh>& gf,
+    const word& name,
+    const dimensionSet& dims,
+    const Op& op
+)
+{
+    auto tres = GeometricField<Result, PatchField, GeoMesh>::New
+    (
+        name,
+        gf.mesh(),
+        dims
+    );
+    auto& res = tres.ref();
+    auto& resInternal = res.primitiveFieldRef();
+    auto& resBoundary = res.boundaryFieldRef();
+
+    nb::gil_scoped_release release;
+
+    transform(resInternal, gf.primitiveField(), op);
+
+    forAll(resBoundary, patchi)
+    {
+        Field<Result>& rp = resBoundary[patchi];
+        const Field<Type>& p = gf.boundaryField()[patchi];
+        forAll(rp, facei)
+        {
+            rp[facei] = op(p[facei]);
+        }
+    }
+
+    return tres;
+}
+
+
+//- Geometric field named name with values op(gf1, gf2)
+template
+<
+    class Result, class Type1, class Type2,
+    template<class> class PatchField, class GeoMesh, class Op
+>
+tmp<GeometricField<Result, PatchField, GeoMesh>> binary
+(
+    const GeometricField<Type1, PatchField, GeoMesh>& gf1,
+    const GeometricField<Type2, PatchField, GeoMesh>& gf2,
+    const word& name,
+    const dimensionSet& dims,
+    const Op& op
+)
+{
+    auto tres = GeometricField<Result, PatchField, GeoMesh>::New
+    (
+        name,
+        gf1.mesh(),
+        dims
+    );
+    auto& res = tres.ref();
+    auto& resInternal = res.primitiveFieldRef();
+    auto& resBoundary = res.boundaryFieldRef();
+
+    nb::gil_scoped_release release;
+
+    transform(resInternal, gf1.primitiveField(), gf2.primitiveField(), op);
+
+    forAll(resBoundary, patchi)
+    {
+        Field<Result>& rp = resBoundary[patchi];
+        const Field<Type1>& p1 = gf1.boundaryField()[patchi];
+        const Field<Type2>& p2 = gf2.boundaryField()[patchi];
+        forAll(rp, facei)
+        {
+            rp[facei] = op(p1[facei], p2[facei]);
+        }
+    }
+
+    return tres;
+}
+
+} // End namespace kernels
+} // End namespace Foam
+
+#endif
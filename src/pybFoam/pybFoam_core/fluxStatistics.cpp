@@ -0,0 +1,191 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "fluxStatistics.hpp"
+#include "parallelFor.hpp"
+#include "FixedList.H"
+#include "PstreamReduceOps.H"
+
+#include <stdexcept>
+#include <string>
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace
+{
+
+using namespace Foam;
+
+//- Per-cell sums of a range of cells
+struct cellSums
+{
+    scalar sumMagPhi = 0;
+    scalar sumV = 0;
+    scalar sumMagDiv = 0;
+    scalar sumDiv = 0;
+    scalar maxMagPhiByV = 0;
+
+    cellSums() = default;
+
+    cellSums(const zero)
+    {}
+
+    void operator+=(const cellSums& s)
+    {
+        sumMagPhi += s.sumMagPhi;
+        sumV += s.sumV;
+        sumMagDiv += s.sumMagDiv;
+        sumDiv += s.sumDiv;
+        maxMagPhiByV = Foam::max(maxMagPhiByV, s.maxMagPhiByV);
+    }
+};
+
+
+//- Processor reduction of cellSums packed as (sums..., max)
+struct cellSumsReduceOp
+{
+    FixedList<scalar, 5> operator()
+    (
+        const FixedList<scalar, 5>& a,
+        const FixedList<scalar, 5>& b
+    ) const
+    {
+        FixedList<scalar, 5> result;
+        for (label i = 0; i < 4; ++i)
+        {
+            result[i] = a[i] + b[i];
+        }
+        result[4] = Foam::max(a[4], b[4]);
+        return result;
+    }
+};
+
+} // End anonymous namespace
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::fluxStatistics::fluxStatistics
+(
+    const surfaceScalarField& phi,
+    UList<scalar>* Co
+)
+{
+    const fvMesh& mesh = phi.mesh();
+    const label nCells = mesh.nCells();
+    const scalar deltaT = mesh.time().deltaTValue();
+
+    if (Co && Co->size() != nCells)
+    {
+        throw std::runtime_error
+        (
+            "fluxStatistics: Co has " + std::to_string(Co->size())
+          + " entries, the mesh " + std::to_string(nCells) + " cells"
+        );
+    }
+
+    // Boundary faces first, serially: few faces, scattered over the cells
+    scalarField boundaryMagPhi(nCells, Zero);
+    scalarField boundaryPhi(nCells, Zero);
+
+    forAll(mesh.boundary(), patchi)
+    {
+        const labelUList& faceCells = mesh.boundary()[patchi].faceCells();
+        const fvsPatchScalarField& pphi = phi.boundaryField()[patchi];
+
+        forAll(faceCells, facei)
+        {
+            boundaryMagPhi[faceCells[facei]] += mag(pphi[facei]);
+            boundaryPhi[faceCells[facei]] += pphi[facei];
+        }
+    }
+
+    // Demand-driven addressing, created here before the threads start
+    const lduAddressing& addr = mesh.lduAddr();
+    const labelUList& ownerStart = addr.ownerStartAddr();
+    const labelUList& losort = addr.losortAddr();
+    const labelUList& losortStart = addr.losortStartAddr();
+    const scalarField& iphi = phi.primitiveField();
+    const scalarField& V = mesh.V().field();
+
+    const cellSums local = parallel::parallelSum<cellSums>
+    (
+        nCells,
+        [&](const label start, const label end)
+        {
+            cellSums s;
+
+            for (label celli = start; celli < end; ++celli)
+            {
+                scalar magPhi = boundaryMagPhi[celli];
+                scalar divPhi = boundaryPhi[celli];
+
+                for (label facei = ownerStart[celli]; facei < ownerStart[celli + 1]; ++facei)
+                {
+                    magPhi += mag(iphi[facei]);
+                    divPhi += iphi[facei];
+                }
+
+                for (label i = losortStart[celli]; i < losortStart[celli + 1]; ++i)
+                {
+                    const scalar phif = iphi[losort[i]];
+                    magPhi += mag(phif);
+                    divPhi -= phif;
+                }
+
+                const scalar magPhiByV = magPhi/V[celli];
+
+                s.sumMagPhi += magPhi;
+                s.sumV += V[celli];
+                s.sumMagDiv += mag(divPhi);
+                s.sumDiv += divPhi;
+                s.maxMagPhiByV = Foam::max(s.maxMagPhiByV, magPhiByV);
+
+                if (Co)
+                {
+                    (*Co)[celli] = 0.5*magPhiByV*deltaT;
+                }
+            }
+
+            return s;
+        }
+    );
+
+    FixedList<scalar, 5> global
+    {
+        local.sumMagPhi,
+        local.sumV,
+        local.sumMagDiv,
+        local.sumDiv,
+        local.maxMagPhiByV
+    };
+    reduce(global, cellSumsReduceOp());
+
+    const scalar sumV = global[1];
+
+    maxCo = 0.5*global[4]*deltaT;
+
+    if (sumV > VSMALL)
+    {
+        meanCo = 0.5*global[0]/sumV*deltaT;
+        localContErr = deltaT*global[2]/sumV;
+        globalContErr = deltaT*global[3]/sumV;
+    }
+}
+
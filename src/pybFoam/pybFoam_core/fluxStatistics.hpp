@@ -0,0 +1,82 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::fluxStatistics
+
+Description
+    Courant numbers and continuity errors of a face flux, computed in one
+    pass over the cells.
+
+    Every cell gathers |phi| and phi of its owner faces (ownerStartAddr)
+    and neighbour faces (losortAddr); the boundary faces are summed
+    beforehand. From these sums each cell contributes to the maximum and
+    mean Courant number and to the local (sum |div phi|) and global
+    (sum div phi) continuity error, so no surfaceSum, div or mag fields
+    are created. The cells are split over the thread pool, the partial
+    results are combined in chunk order and reduced over the processors
+    in a single reduction.
+
+    Equals the Courant number and continuity error of OpenFOAM's
+    CourantNo.H and continuityErrs.H up to the summation order.
+
+SourceFiles
+    fluxStatistics.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_fluxStatistics
+#define foam_fluxStatistics
+
+#include "surfaceFields.H"
+
+namespace Foam
+{
+
+class fluxStatistics
+{
+public:
+
+    // Public Data
+
+        //- Largest cell Courant number
+        scalar maxCo = 0;
+
+        //- Volume weighted mean Courant number
+        scalar meanCo = 0;
+
+        //- deltaT times the volume weighted mean of |div(phi)|
+        scalar localContErr = 0;
+
+        //- deltaT times the volume weighted mean of div(phi)
+        scalar globalContErr = 0;
+
+
+    // Constructors
+
+        //- Compute from phi and the time step of its mesh. If Co is not
+        //  null it receives the Courant number of every cell.
+        explicit fluxStatistics
+        (
+            const surfaceScalarField& phi,
+            UList<scalar>* Co = nullptr
+        );
+};
+
+} // End namespace Foam
+
+#endif
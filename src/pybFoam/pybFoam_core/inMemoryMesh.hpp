@@ -0,0 +1,100 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+    Construct an fvMesh from a polyMesh in memory, without writing the
+    polyMesh and reading it back.
+
+    Points, faces, owner and neighbour are copied into the new mesh, patches
+    and point/face/cell zones are cloned onto it. Header only, so that the
+    meshing module can use it as well.
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_inMemoryMesh
+#define foam_inMemoryMesh
+
+#include "fvMesh.H"
+#include "polyMesh.H"
+#include "polyPatch.H"
+#include "pointZone.H"
+#include "faceZone.H"
+#include "cellZone.H"
+
+namespace Foam
+{
+
+//- New fvMesh with the topology, patches and zones of src
+inline fvMesh* newFvMesh(const polyMesh& src, const IOobject& io)
+{
+    fvMesh* meshPtr = new fvMesh
+    (
+        io,
+        pointField(src.points()),
+        faceList(src.faces()),
+        labelList(src.faceOwner()),
+        labelList(src.faceNeighbour())
+    );
+    fvMesh& mesh = *meshPtr;
+
+    const polyBoundaryMesh& srcPatches = src.boundaryMesh();
+    List<polyPatch*> patches(srcPatches.size());
+    forAll(srcPatches, patchi)
+    {
+        patches[patchi] = srcPatches[patchi].clone
+        (
+            mesh.boundaryMesh(),
+            patchi,
+            srcPatches[patchi].size(),
+            srcPatches[patchi].start()
+        ).ptr();
+    }
+    mesh.addFvPatches(patches);
+
+    const pointZoneMesh& srcPointZones = src.pointZones();
+    const faceZoneMesh& srcFaceZones = src.faceZones();
+    const cellZoneMesh& srcCellZones = src.cellZones();
+
+    if (srcPointZones.size() || srcFaceZones.size() || srcCellZones.size())
+    {
+        List<pointZone*> pz(srcPointZones.size());
+        forAll(srcPointZones, zonei)
+        {
+            pz[zonei] = srcPointZones[zonei].clone(mesh.pointZones()).ptr();
+        }
+
+        List<faceZone*> fz(srcFaceZones.size());
+        forAll(srcFaceZones, zonei)
+        {
+            fz[zonei] = srcFaceZones[zonei].clone(mesh.faceZones()).ptr();
+        }
+
+        List<cellZone*> cz(srcCellZones.size());
+        forAll(srcCellZones, zonei)
+        {
+            cz[zonei] = srcCellZones[zonei].clone(mesh.cellZones()).ptr();
+        }
+
+        mesh.addZones(pz, fz, cz);
+    }
+
+    return meshPtr;
+}
+
+} // End namespace Foam
+
+#endif
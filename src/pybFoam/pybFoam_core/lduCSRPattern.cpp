@@ -0,0 +1,162 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "lduCSRPattern.hpp"
+#include "parallelFor.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace Foam
+{
+    defineTypeNameAndDebug(lduCSRPattern, 0);
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::lduCSRPattern::lduCSRPattern(const fvMesh& mesh)
+:
+    MeshObject<fvMesh, TopologicalMeshObject, lduCSRPattern>(mesh),
+    indptr_(),
+    indices_(),
+    diagPos_(),
+    upperPos_(),
+    lowerPos_()
+{
+    const lduAddressing& addr = mesh.lduAddr();
+    const labelUList& l = addr.lowerAddr();
+    const labelUList& u = addr.upperAddr();
+    const label nCells = addr.size();
+    const label nFaces = l.size();
+
+    // Row sizes: the diagonal plus one entry per face of the cell
+    labelList indptr(nCells + 1);
+    indptr = 1;
+    forAll(l, facei)
+    {
+        ++indptr[l[facei]];
+        ++indptr[u[facei]];
+    }
+
+    label nnz = 0;
+    for (label celli = 0; celli < nCells; ++celli)
+    {
+        const label n = indptr[celli];
+        indptr[celli] = nnz;
+        nnz += n;
+    }
+    indptr[nCells] = nnz;
+
+    // Entries as (column, source) with source -1 for the diagonal,
+    // 2*facei for upper and 2*facei + 1 for lower
+    std::vector<std::pair<label, label>> entries(nnz);
+    labelList next(SubList<label>(indptr, nCells));
+
+    for (label celli = 0; celli < nCells; ++celli)
+    {
+        entries[next[celli]++] = {celli, -1};
+    }
+    for (label facei = 0; facei < nFaces; ++facei)
+    {
+        entries[next[l[facei]]++] = {u[facei], 2*facei};
+        entries[next[u[facei]]++] = {l[facei], 2*facei + 1};
+    }
+
+    labelList indices(nnz);
+    diagPos_.resize(nCells);
+    upperPos_.resize(nFaces);
+    lowerPos_.resize(nFaces);
+
+    for (label celli = 0; celli < nCells; ++celli)
+    {
+        const auto first = entries.begin() + indptr[celli];
+        const auto last = entries.begin() + indptr[celli + 1];
+        std::sort(first, last);
+
+        for (label pos = indptr[celli]; pos < indptr[celli + 1]; ++pos)
+        {
+            const label col = entries[pos].first;
+            const label source = entries[pos].second;
+
+            indices[pos] = col;
+            if (source < 0)
+            {
+                diagPos_[celli] = pos;
+            }
+            else if (source % 2 == 0)
+            {
+                upperPos_[source/2] = pos;
+            }
+            else
+            {
+                lowerPos_[source/2] = pos;
+            }
+        }
+    }
+
+    indptr_ = std::make_shared<const labelList>(std::move(indptr));
+    indices_ = std::make_shared<const labelList>(std::move(indices));
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void Foam::lduCSRPattern::values
+(
+    const lduMatrix& matrix,
+    const scalarField& diag,
+    scalar* data
+) const
+{
+    parallel::parallelFor
+    (
+        diag.size(),
+        [&](const label start, const label end)
+        {
+            for (label celli = start; celli < end; ++celli)
+            {
+                data[diagPos_[celli]] = diag[celli];
+            }
+        }
+    );
+
+    // A diagonal matrix has no off-diagonal storage; the const lower() of
+    // a symmetric matrix is its upper()
+    const bool offDiag = matrix.hasUpper() || matrix.hasLower();
+    const scalarField* upper = offDiag ? &matrix.upper() : nullptr;
+    const scalarField* lower = offDiag ? &matrix.lower() : nullptr;
+
+    parallel::parallelFor
+    (
+        upperPos_.size(),
+        [&](const label start, const label end)
+        {
+            for (label facei = start; facei < end; ++facei)
+            {
+                data[upperPos_[facei]] = upper ? (*upper)[facei] : 0;
+                data[lowerPos_[facei]] = lower ? (*lower)[facei] : 0;
+            }
+        }
+    );
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,156 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::lduCSRPattern
+
+Description
+    Compressed sparse row pattern of the lduMatrix of a mesh, with the
+    position of every diagonal, upper and lower coefficient in the CSR
+    value array, cached on the mesh.
+
+    For face f with l = lowerAddr[f] and u = upperAddr[f], upper[f] is the
+    entry (l, u) and lower[f] the entry (u, l). The columns of each row are
+    sorted. Filling the CSR values of a matrix is then a scatter of diag,
+    upper and lower through the cached positions, without searching.
+
+    The pattern is stored on the mesh as a TopologicalMeshObject and is
+    dropped on topology changes. indptr and indices are held by shared_ptr,
+    so NumPy views of them outlive the pattern.
+
+SourceFiles
+    lduCSRPattern.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_lduCSRPattern
+#define foam_lduCSRPattern
+
+#include "MeshObject.H"
+#include "fvMesh.H"
+#include "fvMatrix.H"
+#include "labelList.H"
+
+#include <memory>
+
+namespace Foam
+{
+
+class lduCSRPattern
+:
+    public MeshObject<fvMesh, TopologicalMeshObject, lduCSRPattern>
+{
+    // Private Data
+
+        //- Start of each row in indices_, nCells + 1 entries
+        std::shared_ptr<const labelList> indptr_;
+
+        //- Column of every entry
+        std::shared_ptr<const labelList> indices_;
+
+        //- Position of the diagonal of each cell
+        labelList diagPos_;
+
+        //- Position of the upper and lower coefficient of each face
+        labelList upperPos_;
+        labelList lowerPos_;
+
+
+public:
+
+    //- Runtime type information
+    TypeName("lduCSRPattern");
+
+
+    // Constructors
+
+        explicit lduCSRPattern(const fvMesh& mesh);
+
+
+    // Member Functions
+
+        label nRows() const noexcept
+        {
+            return diagPos_.size();
+        }
+
+        label nnz() const noexcept
+        {
+            return indices_->size();
+        }
+
+        const std::shared_ptr<const labelList>& indptr() const noexcept
+        {
+            return indptr_;
+        }
+
+        const std::shared_ptr<const labelList>& indices() const noexcept
+        {
+            return indices_;
+        }
+
+        //- CSR values of the coefficients of an lduMatrix on this mesh
+        void values(const lduMatrix& matrix, scalar* data) const
+        {
+            values(matrix, matrix.diag(), data);
+        }
+
+        //- CSR values of the matrix coefficients, with diag in place of
+        //  the matrix diagonal
+        void values
+        (
+            const lduMatrix& matrix,
+            const scalarField& diag,
+            scalar* data
+        ) const;
+
+        //- CSR values of the matrix coefficients. With boundary, the
+        //  internalCoeffs (component cmpt) of all patches are added to the
+        //  diagonal as done before solving.
+        template<class Type>
+        void values
+        (
+            const fvMatrix<Type>& matrix,
+            scalar* data,
+            const direction cmpt,
+            const bool boundary
+        ) const
+        {
+            if (!boundary)
+            {
+                values(matrix, data);
+                return;
+            }
+
+            scalarField diag(matrix.diag());
+            forAll(matrix.internalCoeffs(), patchi)
+            {
+                const labelUList& faceCells = matrix.lduAddr().patchAddr(patchi);
+                const Field<Type>& coeffs = matrix.internalCoeffs()[patchi];
+                forAll(faceCells, i)
+                {
+                    diag[faceCells[i]] += component(coeffs[i], cmpt);
+                }
+            }
+
+            values(matrix, diag, data);
+        }
+};
+
+} // End namespace Foam
+
+#endif
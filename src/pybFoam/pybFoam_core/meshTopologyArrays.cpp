@@ -0,0 +1,81 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "meshTopologyArrays.hpp"
+
+namespace Foam
+{
+    defineTypeNameAndDebug(meshTopologyArrays, 0);
+
+    //- Flatten a list of lists into offsets and values
+    template<class ListType>
+    static void flatten
+    (
+        const UList<ListType>& lists,
+        std::shared_ptr<const labelList>& sharedOffsets,
+        std::shared_ptr<const labelList>& sharedValues
+    )
+    {
+        auto offsetsPtr = std::make_shared<labelList>();
+        auto valuesPtr = std::make_shared<labelList>();
+        labelList& offsets = *offsetsPtr;
+        labelList& values = *valuesPtr;
+
+        offsets.resize(lists.size() + 1);
+        label n = 0;
+        forAll(lists, i)
+        {
+            offsets[i] = n;
+            n += lists[i].size();
+        }
+        offsets[lists.size()] = n;
+
+        values.resize(n);
+        forAll(lists, i)
+        {
+            const ListType& l = lists[i];
+            label* dest = values.data() + offsets[i];
+            forAll(l, j)
+            {
+                dest[j] = l[j];
+            }
+        }
+
+        sharedOffsets = std::move(offsetsPtr);
+        sharedValues = std::move(valuesPtr);
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::meshTopologyArrays::meshTopologyArrays(const polyMesh& mesh)
+:
+    MeshObject<polyMesh, TopologicalMeshObject, meshTopologyArrays>(mesh),
+    faceOffsets_(),
+    facePoints_(),
+    cellOffsets_(),
+    cellFaces_()
+{
+    flatten(mesh.faces(), faceOffsets_, facePoints_);
+    flatten(mesh.cells(), cellOffsets_, cellFaces_);
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,184 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::meshTopologyArrays
+
+Description
+    Face-point and cell-face connectivity of a mesh in compressed sparse row
+    form (offsets of size n + 1 and the flat labels), cached on the mesh.
+
+    faceList and cellList store every face/cell as a separate list, so they
+    are flattened once on first use. The arrays are stored on the mesh as a
+    TopologicalMeshObject and are dropped on topology changes.
+
+    bindMeshArrays adds the NumPy accessors to the polyMesh and fvMesh
+    classes. points, owner and neighbour are read-only views of the mesh
+    storage, the CSR arrays read-only views of the cached lists. The lists
+    are held by shared_ptr and the views share their ownership, so a view
+    stays valid after the mesh has dropped the cache.
+
+SourceFiles
+    meshTopologyArrays.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_meshTopologyArrays
+#define foam_meshTopologyArrays
+
+#include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
+#include <nanobind/stl/pair.h>
+
+#include <memory>
+#include <utility>
+
+#include "MeshObject.H"
+#include "polyMesh.H"
+#include "labelList.H"
+#include "arrayExport.hpp"
+
+namespace nb = nanobind;
+
+namespace Foam
+{
+
+class meshTopologyArrays
+:
+    public MeshObject<polyMesh, TopologicalMeshObject, meshTopologyArrays>
+{
+    // Private Data
+
+        //- Start of each face in facePoints_, nFaces + 1 entries
+        std::shared_ptr<const labelList> faceOffsets_;
+
+        //- Point labels of all faces
+        std::shared_ptr<const labelList> facePoints_;
+
+        //- Start of each cell in cellFaces_, nCells + 1 entries
+        std::shared_ptr<const labelList> cellOffsets_;
+
+        //- Face labels of all cells
+        std::shared_ptr<const labelList> cellFaces_;
+
+
+public:
+
+    //- Runtime type information
+    TypeName("meshTopologyArrays");
+
+
+    // Constructors
+
+        explicit meshTopologyArrays(const polyMesh& mesh);
+
+
+    // Member Functions
+
+        const std::shared_ptr<const labelList>& faceOffsets() const noexcept
+        {
+            return faceOffsets_;
+        }
+
+        const std::shared_ptr<const labelList>& facePoints() const noexcept
+        {
+            return facePoints_;
+        }
+
+        const std::shared_ptr<const labelList>& cellOffsets() const noexcept
+        {
+            return cellOffsets_;
+        }
+
+        const std::shared_ptr<const labelList>& cellFaces() const noexcept
+        {
+            return cellFaces_;
+        }
+};
+
+
+//- Add points/owner/neighbour arrays and the CSR face and cell arrays
+template<class MeshType, class... Extra>
+void bindMeshArrays(nb::class_<MeshType, Extra...>& cls)
+{
+    cls.def
+    (
+        "pointsArray",
+        [](nb::handle self)
+        {
+            const polyMesh& mesh = nb::cast<const MeshType&>(self);
+            return arrayExport::numpyConstView(mesh.points(), self);
+        },
+        "Point coordinates (nPoints, 3), read-only view of the mesh points"
+    )
+    .def
+    (
+        "ownerArray",
+        [](nb::handle self)
+        {
+            const polyMesh& mesh = nb::cast<const MeshType&>(self);
+            return arrayExport::numpyConstView(mesh.faceOwner(), self);
+        },
+        "Owner cell of every face, read-only view"
+    )
+    .def
+    (
+        "neighbourArray",
+        [](nb::handle self)
+        {
+            const polyMesh& mesh = nb::cast<const MeshType&>(self);
+            return arrayExport::numpyConstView(mesh.faceNeighbour(), self);
+        },
+        "Neighbour cell of every internal face, read-only view"
+    )
+    .def
+    (
+        "facesCSR",
+        [](nb::handle self)
+        {
+            const meshTopologyArrays& arrays =
+                meshTopologyArrays::New(nb::cast<const MeshType&>(self));
+            return std::make_pair
+            (
+                arrayExport::numpyConstView(arrays.faceOffsets()),
+                arrayExport::numpyConstView(arrays.facePoints())
+            );
+        },
+        "(offsets, pointLabels) of the faces, face i is\n"
+        "pointLabels[offsets[i]:offsets[i + 1]]"
+    )
+    .def
+    (
+        "cellsCSR",
+        [](nb::handle self)
+        {
+            const meshTopologyArrays& arrays =
+                meshTopologyArrays::New(nb::cast<const MeshType&>(self));
+            return std::make_pair
+            (
+                arrayExport::numpyConstView(arrays.cellOffsets()),
+                arrayExport::numpyConstView(arrays.cellFaces())
+            );
+        },
+        "(offsets, faceLabels) of the cells, cell i is\n"
+        "faceLabels[offsets[i]:offsets[i + 1]]"
+    );
+}
+
+} // End namespace Foam
+
+#endif
@@ -0,0 +1,312 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::parallel::threadPool
+
+Description
+    Minimal thread pool for splitting element-wise field loops into chunks.
+
+    The pool is sized by set_num_threads() and defaults to a single thread,
+    i.e. plain serial loops. Work functions must only touch raw field
+    storage: OpenFOAM objects (tmp reference counts, registries, patch
+    field construction) are not thread-safe.
+
+    Every extension module gets its own pool since the modules are built
+    with hidden visibility; pybFoam.set_num_threads() configures all of them.
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_parallelFor
+#define foam_parallelFor
+
+#include "label.H"
+#include "zero.H"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Foam
+{
+namespace parallel
+{
+
+//- Smallest number of elements worth handing to a separate thread
+constexpr label minChunkSize = 8192;
+
+
+class threadPool
+{
+    std::vector<std::thread> workers_;
+
+    //- Serialises run() and resize(); a caller that finds the pool busy
+    //  (another Python thread with the GIL released) runs serially
+    std::mutex runMutex_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+
+    const std::function<void(label)>* task_ = nullptr;
+    label nTasks_ = 0;
+    std::atomic<label> next_{0};
+    label pending_ = 0;
+    unsigned long generation_ = 0;
+    bool stop_ = false;
+    std::exception_ptr error_;
+
+    void work()
+    {
+        for (label t = next_++; t < nTasks_; t = next_++)
+        {
+            try
+            {
+                (*task_)(t);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_)
+                {
+                    error_ = std::current_exception();
+                }
+            }
+        }
+    }
+
+    void workerLoop()
+    {
+        unsigned long seen = 0;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_)
+                {
+                    return;
+                }
+                seen = generation_;
+            }
+
+            work();
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (--pending_ == 0)
+            {
+                done_.notify_one();
+            }
+        }
+    }
+
+    void stopWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& t : workers_)
+        {
+            t.join();
+        }
+        workers_.clear();
+        stop_ = false;
+    }
+
+    threadPool() = default;
+
+public:
+
+    threadPool(const threadPool&) = delete;
+    void operator=(const threadPool&) = delete;
+
+    ~threadPool()
+    {
+        stopWorkers();
+    }
+
+    static threadPool& instance()
+    {
+        static threadPool pool;
+        return pool;
+    }
+
+    //- Number of threads including the calling thread
+    label size() const
+    {
+        return label(workers_.size()) + 1;
+    }
+
+    //- Set the number of threads; values < 1 select the hardware concurrency
+    void resize(label nThreads)
+    {
+        if (nThreads < 1)
+        {
+            nThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        std::lock_guard<std::mutex> runLock(runMutex_);
+        stopWorkers();
+        for (label i = 1; i < nThreads; ++i)
+        {
+            workers_.emplace_back([this] { workerLoop(); });
+        }
+    }
+
+    //- Call task(0) ... task(nTasks - 1), distributed over the pool.
+    //  Returns once all tasks are done and rethrows the first exception.
+    void run(const label nTasks, const std::function<void(label)>& task)
+    {
+        std::unique_lock<std::mutex> runLock(runMutex_, std::try_to_lock);
+        if (!runLock.owns_lock() || workers_.empty() || nTasks < 2)
+        {
+            for (label t = 0; t < nTasks; ++t)
+            {
+                task(t);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            nTasks_ = nTasks;
+            next_ = 0;
+            pending_ = label(workers_.size());
+            error_ = nullptr;
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        work();
+
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [&] { return pending_ == 0; });
+            task_ = nullptr;
+            std::swap(error, error_);
+        }
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+};
+
+
+inline void setNumThreads(const label nThreads)
+{
+    threadPool::instance().resize(nThreads);
+}
+
+inline label numThreads()
+{
+    return threadPool::instance().size();
+}
+
+
+//- Number of chunks a loop over n elements is split into. Depends only on
+//  n and the pool size, so chunked reductions are reproducible.
+inline label nChunks(const label n)
+{
+    return std::max<label>
+    (
+        1,
+        std::min<label>(numThreads(), n/minChunkSize)
+    );
+}
+
+
+//- Call f(chunki, start, end) for the chunks of [0, n)
+template<class Func>
+void forChunks(const label n, const label nChunk, const Func& f)
+{
+    if (nChunk == 1)
+    {
+        f(label(0), label(0), n);
+        return;
+    }
+
+    threadPool::instance().run
+    (
+        nChunk,
+        [&](const label chunki)
+        {
+            const label start = (int64_t(n)*chunki)/nChunk;
+            const label end = (int64_t(n)*(chunki + 1))/nChunk;
+            f(chunki, start, end);
+        }
+    );
+}
+
+
+//- Call f(start, end) on disjoint ranges covering [0, n)
+template<class Func>
+void parallelFor(const label n, const Func& f)
+{
+    forChunks
+    (
+        n,
+        nChunks(n),
+        [&](const label, const label start, const label end)
+        {
+            f(start, end);
+        }
+    );
+}
+
+
+//- Sum of f(start, end) over disjoint ranges covering [0, n). Partial
+//  results are combined in chunk order.
+template<class Type, class Func>
+Type parallelSum(const label n, const Func& f)
+{
+    const label nChunk = nChunks(n);
+    std::vector<Type> partial(nChunk, Type(Zero));
+
+    forChunks
+    (
+        n,
+        nChunk,
+        [&](const label chunki, const label start, const label end)
+        {
+            partial[chunki] = f(start, end);
+        }
+    );
+
+    Type result(Zero);
+    for (const Type& p : partial)
+    {
+        result += p;
+    }
+    return result;
+}
+
+} // End namespace parallel
+} // End namespace Foam
+
+#endif
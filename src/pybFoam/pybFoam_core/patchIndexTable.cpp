@@ -0,0 +1,99 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "patchIndexTable.hpp"
+
+#include <stdexcept>
+
+namespace Foam
+{
+    defineTypeNameAndDebug(patchIndexTable, 0);
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+void Foam::patchIndexTable::calcIndices() const
+{
+    const polyBoundaryMesh& patches = mesh().boundaryMesh();
+
+    indices_.clear();
+    indices_.resize(2*patches.size());
+    forAll(patches, patchi)
+    {
+        indices_.insert(patches[patchi].name(), patchi);
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::patchIndexTable::patchIndexTable(const polyMesh& mesh)
+:
+    MeshObject<polyMesh, TopologicalMeshObject, patchIndexTable>(mesh),
+    indices_()
+{
+    calcIndices();
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+Foam::label Foam::patchIndexTable::find(const word& patchName) const
+{
+    const polyBoundaryMesh& patches = mesh().boundaryMesh();
+
+    auto iter = indices_.cfind(patchName);
+    if
+    (
+        iter.good()
+     && iter.val() < patches.size()
+     && patches[iter.val()].name() == patchName
+    )
+    {
+        return iter.val();
+    }
+
+    // Unknown name or stale table
+    calcIndices();
+    iter = indices_.cfind(patchName);
+    if (iter.good())
+    {
+        return iter.val();
+    }
+
+    return -1;
+}
+
+
+Foam::label Foam::patchIndexTable::index(const word& patchName) const
+{
+    const label patchi = find(patchName);
+    if (patchi < 0)
+    {
+        throw std::runtime_error
+        (
+            "patch not found: " + patchName
+        );
+    }
+    return patchi;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,82 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::patchIndexTable
+
+Description
+    Patch name to index lookup cached on the mesh.
+
+    polyBoundaryMesh::findPatchID searches the patch names linearly; the
+    bindings look patches up by name on every field access. The table is
+    stored on the mesh as a TopologicalMeshObject, so it is dropped on
+    topology changes, and an entry is checked against the boundary before
+    use so that a boundary replaced in place is picked up as well.
+
+SourceFiles
+    patchIndexTable.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_patchIndexTable
+#define foam_patchIndexTable
+
+#include "MeshObject.H"
+#include "polyMesh.H"
+#include "HashTable.H"
+
+namespace Foam
+{
+
+class patchIndexTable
+:
+    public MeshObject<polyMesh, TopologicalMeshObject, patchIndexTable>
+{
+    // Private Data
+
+        //- Patch index by name, rebuilt when found to be stale
+        mutable HashTable<label, word> indices_;
+
+
+    // Private Member Functions
+
+        void calcIndices() const;
+
+
+public:
+
+    //- Runtime type information
+    TypeName("patchIndexTable");
+
+
+    // Constructors
+
+        explicit patchIndexTable(const polyMesh& mesh);
+
+
+    // Member Functions
+
+        //- Index of the patch, -1 if there is no such patch
+        label find(const word& patchName) const;
+
+        //- Index of the patch, throws std::runtime_error if not found
+        label index(const word& patchName) const;
+};
+
+} // End namespace Foam
+
+#endif
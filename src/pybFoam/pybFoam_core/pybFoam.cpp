@@ -18,6 +18,7 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/string.h>
 #include "bind_io.hpp"
 #include "bind_dict.hpp"
 #include "bind_time.hpp"
@@ -32,6 +33,8 @@ License
 #include "bind_cfdTools.hpp"
 #include "bind_wallDist.hpp"
 #include "bind_pstream.hpp"
+#include "parallelFor.hpp"
+#include "simdKernels.hpp"
 
 namespace nb = nanobind;
 
@@ -53,4 +56,20 @@ NB_MODULE(pybFoam_core, m) {
     Foam::bindCfdTools(m);
     Foam::bindWallDist(m);
     Foam::bindPstream(m);
+
+    m.def("set_num_threads", &Foam::parallel::setNumThreads, nb::arg("n"),
+        "Set the number of threads of the field kernels in this module (n < 1: all cores)");
+    m.def("get_num_threads", &Foam::parallel::numThreads,
+        "Number of threads of the field kernels in this module");
+
+    m.def("simd_isa", []() -> std::string { return Foam::simd::name(Foam::simd::active()); },
+        "Instruction set of the vector/tensor field kernels: scalar, avx2 or avx512");
+    m.def("set_simd_isa",
+        [](const std::string& name)
+        {
+            Foam::simd::setActive(Foam::simd::fromName(name));
+        },
+        nb::arg("name"),
+        "Select the instruction set of the field kernels, limited to what the "
+        "CPU supports; for benchmarking");
 }
@@ -0,0 +1,218 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "pythonSolver.hpp"
+
+#include <stdexcept>
+#include <string>
+
+namespace Foam
+{
+    defineTypeNameAndDebug(pythonSolver, 0);
+
+    lduMatrix::solver::addsymMatrixConstructorToTable<pythonSolver>
+        addpythonSolverSymMatrixConstructorToTable_;
+
+    lduMatrix::solver::addasymMatrixConstructorToTable<pythonSolver>
+        addpythonSolverAsymMatrixConstructorToTable_;
+}
+
+
+// * * * * * * * * * * * * * pythonSolverSystem  * * * * * * * * * * * * * //
+
+void Foam::pythonSolverSystem::check() const
+{
+    if (!valid_)
+    {
+        throw std::runtime_error
+        (
+            "the linear system is only valid during the solver callback"
+        );
+    }
+}
+
+
+Foam::tmp<Foam::scalarField>
+Foam::pythonSolverSystem::Amul(const scalarField& x) const
+{
+    check();
+    if (x.size() != psi_.size())
+    {
+        throw std::runtime_error
+        (
+            "expected " + std::to_string(psi_.size()) + " values, got "
+          + std::to_string(x.size())
+        );
+    }
+
+    auto tAx = tmp<scalarField>::New(x.size());
+    solver_.Amul(tAx.ref(), x, cmpt_);
+    return tAx;
+}
+
+
+Foam::tmp<Foam::scalarField>
+Foam::pythonSolverSystem::residual(const scalarField& x) const
+{
+    tmp<scalarField> tr = Amul(x);
+    scalarField& r = tr.ref();
+    forAll(r, celli)
+    {
+        r[celli] = source_[celli] - r[celli];
+    }
+    return tr;
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::pythonSolver::pythonSolver
+(
+    const word& fieldName,
+    const lduMatrix& matrix,
+    const FieldField<Field, scalar>& interfaceBouCoeffs,
+    const FieldField<Field, scalar>& interfaceIntCoeffs,
+    const lduInterfaceFieldPtrsList& interfaces,
+    const dictionary& solverControls
+)
+:
+    lduMatrix::solver
+    (
+        fieldName,
+        matrix,
+        interfaceBouCoeffs,
+        interfaceIntCoeffs,
+        interfaces,
+        solverControls
+    ),
+    callback_(solverControls.get<word>("callback"))
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+nb::dict& Foam::pythonSolver::callbacks()
+{
+    // Never destroyed: the interpreter may be gone at static destruction
+    static nb::dict* functions = new nb::dict();
+    return *functions;
+}
+
+
+void Foam::pythonSolver::read(const dictionary& solverControls)
+{
+    lduMatrix::solver::read(solverControls);
+    callback_ = solverControls.get<word>("callback");
+}
+
+
+void Foam::pythonSolver::Amul
+(
+    scalarField& Ax,
+    const scalarField& x,
+    const direction cmpt
+) const
+{
+    matrix_.Amul
+    (
+        Ax,
+        tmp<scalarField>(x),
+        interfaceBouCoeffs_,
+        interfaces_,
+        cmpt
+    );
+}
+
+
+Foam::solverPerformance Foam::pythonSolver::solve
+(
+    scalarField& psi,
+    const scalarField& source,
+    const direction cmpt
+) const
+{
+    solverPerformance solverPerf(typeName, fieldName_);
+
+    scalarField Apsi(psi.size());
+    scalarField tmpField(psi.size());
+
+    Amul(Apsi, psi, cmpt);
+    const scalar normFactor = this->normFactor(psi, source, Apsi, tmpField);
+
+    solverPerf.initialResidual() =
+        gSumMag(source - Apsi, matrix().mesh().comm())/normFactor;
+    solverPerf.finalResidual() = solverPerf.initialResidual();
+
+    if
+    (
+        minIter_ <= 0
+     && solverPerf.checkConvergence(tolerance_, relTol_, log_)
+    )
+    {
+        return solverPerf;
+    }
+
+    {
+        nb::gil_scoped_acquire acquire;
+
+        nb::dict& functions = callbacks();
+        if (!functions.contains(callback_.c_str()))
+        {
+            throw std::runtime_error
+            (
+                "no linear solver callback '" + std::string(callback_)
+              + "' registered"
+            );
+        }
+
+        nb::object system = nb::cast
+        (
+            new pythonSolverSystem(*this, psi, source, cmpt),
+            nb::rv_policy::take_ownership
+        );
+
+        pythonSolverSystem& sys = nb::cast<pythonSolverSystem&>(system);
+        try
+        {
+            nb::object result = functions[callback_.c_str()](system);
+            if (!result.is_none())
+            {
+                solverPerf.nIterations() = nb::cast<label>(result);
+            }
+        }
+        catch (...)
+        {
+            // Rethrow python_error as is to keep the exception type, its
+            // destructor takes the GIL
+            sys.invalidate();
+            throw;
+        }
+        sys.invalidate();
+    }
+
+    Amul(Apsi, psi, cmpt);
+    solverPerf.finalResidual() =
+        gSumMag(source - Apsi, matrix().mesh().comm())/normFactor;
+    solverPerf.checkConvergence(tolerance_, relTol_, log_);
+
+    return solverPerf;
+}
+
+
+// ************************************************************************* //
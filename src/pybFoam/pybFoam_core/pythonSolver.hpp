@@ -0,0 +1,252 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::pythonSolver
+
+Description
+    lduMatrix solver calling a Python function, selected in fvSolution by
+
+        p
+        {
+            solver      python;
+            callback    myCallback;     // registered name
+            tolerance   1e-6;
+            relTol      0.01;
+        }
+
+    The function is registered with pybFoam.register_linear_solver(name, f)
+    and called as f(system) with a pythonSolverSystem giving NumPy views of
+    the coefficients, the source and the solution (updated in place). It may
+    return the number of iterations. The initial and final residuals are
+    computed here with the usual normalisation, including the coupled
+    interfaces.
+
+    The solver takes the GIL only around the call, so fvMatrix.solve() runs
+    without it otherwise. The views are only valid during the call.
+
+    An exception raised by the function is propagated unchanged (as
+    nb::python_error), so Python sees the original exception type.
+    fvMatrix::solve adds the boundary coefficients to the diagonal and only
+    restores it after a successful solve; the bindings therefore solve
+    through restoreDiagOnError, which copies the diagonal for this solver
+    only.
+
+SourceFiles
+    pythonSolver.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_pythonSolver
+#define foam_pythonSolver
+
+#include <nanobind/nanobind.h>
+
+#include "lduMatrix.H"
+
+namespace nb = nanobind;
+
+namespace Foam
+{
+
+class pythonSolver;
+
+//- The linear system handed to the Python function
+class pythonSolverSystem
+{
+    // Private Data
+
+        const pythonSolver& solver_;
+        scalarField& psi_;
+        const scalarField& source_;
+        const direction cmpt_;
+
+        //- Cleared after the call
+        bool valid_;
+
+
+public:
+
+    // Constructors
+
+        pythonSolverSystem
+        (
+            const pythonSolver& solver,
+            scalarField& psi,
+            const scalarField& source,
+            const direction cmpt
+        )
+        :
+            solver_(solver),
+            psi_(psi),
+            source_(source),
+            cmpt_(cmpt),
+            valid_(true)
+        {}
+
+
+    // Member Functions
+
+        //- Throw if used after the call
+        void check() const;
+
+        void invalidate() noexcept
+        {
+            valid_ = false;
+        }
+
+        const pythonSolver& solver() const
+        {
+            check();
+            return solver_;
+        }
+
+        scalarField& psi()
+        {
+            check();
+            return psi_;
+        }
+
+        const scalarField& source() const
+        {
+            check();
+            return source_;
+        }
+
+        direction cmpt() const noexcept
+        {
+            return cmpt_;
+        }
+
+        //- A*x including the coupled interfaces
+        tmp<scalarField> Amul(const scalarField& x) const;
+
+        //- source - A*x including the coupled interfaces
+        tmp<scalarField> residual(const scalarField& x) const;
+};
+
+
+class pythonSolver
+:
+    public lduMatrix::solver
+{
+    // Private Data
+
+        //- Name of the registered Python function
+        word callback_;
+
+
+public:
+
+    //- Runtime type information
+    TypeName("python");
+
+
+    // Constructors
+
+        pythonSolver
+        (
+            const word& fieldName,
+            const lduMatrix& matrix,
+            const FieldField<Field, scalar>& interfaceBouCoeffs,
+            const FieldField<Field, scalar>& interfaceIntCoeffs,
+            const lduInterfaceFieldPtrsList& interfaces,
+            const dictionary& solverControls
+        );
+
+
+    //- Destructor
+    virtual ~pythonSolver() = default;
+
+
+    // Member Functions
+
+        //- The registered functions by name
+        static nb::dict& callbacks();
+
+        //- Read the solver controls
+        virtual void read(const dictionary& solverControls);
+
+        const word& callback() const noexcept
+        {
+            return callback_;
+        }
+
+        scalar tolerance() const noexcept
+        {
+            return tolerance_;
+        }
+
+        scalar relTol() const noexcept
+        {
+            return relTol_;
+        }
+
+        label maxIter() const noexcept
+        {
+            return maxIter_;
+        }
+
+        //- A*x including the coupled interfaces
+        void Amul(scalarField& Ax, const scalarField& x, direction cmpt) const;
+
+        //- Solve the matrix with the Python function
+        virtual solverPerformance solve
+        (
+            scalarField& psi,
+            const scalarField& source,
+            const direction cmpt = 0
+        ) const;
+};
+
+
+//- Call solve() with the solver controls, restoring the diagonal of
+//  matrix if it throws. Only the Python solver can throw with the
+//  boundary coefficients still added, so only it pays for the copy.
+template<class Solve>
+auto restoreDiagOnError
+(
+    const lduMatrix& matrix,
+    const dictionary& controls,
+    Solve&& solve
+)
+{
+    if
+    (
+        !matrix.hasDiag()
+     || controls.getOrDefault<word>("solver", word::null)
+     != pythonSolver::typeName
+    )
+    {
+        return solve();
+    }
+
+    const scalarField saveDiag(matrix.diag());
+    try
+    {
+        return solve();
+    }
+    catch (...)
+    {
+        const_cast<lduMatrix&>(matrix).diag() = saveDiag;
+        throw;
+    }
+}
+
+} // End namespace Foam
+
+#endif
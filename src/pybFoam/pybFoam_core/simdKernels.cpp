@@ -0,0 +1,774 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "simdKernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+
+#if defined(PYBFOAM_SIMD) && defined(WM_DP) && defined(__x86_64__) \
+ && (defined(__GNUC__) || defined(__clang__))
+    #define PYBFOAM_X86_SIMD
+    #include <immintrin.h>
+    #define PYBFOAM_AVX2 __attribute__((target("avx2")))
+    #define PYBFOAM_AVX512 __attribute__((target("avx512f")))
+#endif
+
+#define PYBFOAM_INLINE inline __attribute__((always_inline))
+
+
+namespace Foam
+{
+namespace simd
+{
+
+// * * * * * * * * * * * * * * * Portable loops  * * * * * * * * * * * * * * //
+
+// Also compiled into the AVX2/AVX-512 variants of the tensor kernels and
+// used for the remainder of the explicitly vectorised vector kernels.
+// This file is built with -ffp-contract=off (see CMakeLists.txt): the wider
+// targets enable FMA and contracting only some variants would change results.
+
+PYBFOAM_INLINE void innerLoop
+(
+    const scalar* a, const scalar* b, scalar* r, label i, const label n
+)
+{
+    for (; i < n; ++i)
+    {
+        const scalar* u = a + 3*i;
+        const scalar* v = b + 3*i;
+        r[i] = u[0]*v[0] + u[1]*v[1] + u[2]*v[2];
+    }
+}
+
+PYBFOAM_INLINE void innerUniformLoop
+(
+    const scalar* a, const scalar* v, scalar* r, label i, const label n
+)
+{
+    for (; i < n; ++i)
+    {
+        const scalar* u = a + 3*i;
+        r[i] = u[0]*v[0] + u[1]*v[1] + u[2]*v[2];
+    }
+}
+
+PYBFOAM_INLINE void magSqrVectorLoop
+(
+    const scalar* a, scalar* r, label i, const label n
+)
+{
+    for (; i < n; ++i)
+    {
+        const scalar* u = a + 3*i;
+        r[i] = u[0]*u[0] + u[1]*u[1] + u[2]*u[2];
+    }
+}
+
+PYBFOAM_INLINE void magVectorLoop
+(
+    const scalar* a, scalar* r, label i, const label n
+)
+{
+    for (; i < n; ++i)
+    {
+        const scalar* u = a + 3*i;
+        r[i] = std::sqrt(u[0]*u[0] + u[1]*u[1] + u[2]*u[2]);
+    }
+}
+
+PYBFOAM_INLINE void multiplyVectorLoop
+(
+    const scalar* a, const scalar* s, scalar* r, label i, const label n
+)
+{
+    for (; i < n; ++i)
+    {
+        for (label c = 0; c < 3; ++c)
+        {
+            r[3*i + c] = a[3*i + c]*s[i];
+        }
+    }
+}
+
+PYBFOAM_INLINE void divideVectorLoop
+(
+    const scalar* a, const scalar* s, scalar* r, label i, const label n
+)
+{
+    for (; i < n; ++i)
+    {
+        for (label c = 0; c < 3; ++c)
+        {
+            r[3*i + c] = a[3*i + c]/s[i];
+        }
+    }
+}
+
+PYBFOAM_INLINE void magSqrTensorLoop(const scalar* t, scalar* r, const label n)
+{
+    for (label i = 0; i < n; ++i)
+    {
+        const scalar* T = t + 9*i;
+        r[i] =
+            T[0]*T[0] + T[1]*T[1] + T[2]*T[2]
+          + T[3]*T[3] + T[4]*T[4] + T[5]*T[5]
+          + T[6]*T[6] + T[7]*T[7] + T[8]*T[8];
+    }
+}
+
+PYBFOAM_INLINE void magTensorLoop(const scalar* t, scalar* r, const label n)
+{
+    for (label i = 0; i < n; ++i)
+    {
+        const scalar* T = t + 9*i;
+        r[i] = std::sqrt
+        (
+            T[0]*T[0] + T[1]*T[1] + T[2]*T[2]
+          + T[3]*T[3] + T[4]*T[4] + T[5]*T[5]
+          + T[6]*T[6] + T[7]*T[7] + T[8]*T[8]
+        );
+    }
+}
+
+PYBFOAM_INLINE void symmTensorOfTensorLoop
+(
+    const scalar* t, scalar* r, const label n
+)
+{
+    for (label i = 0; i < n; ++i)
+    {
+        const scalar* T = t + 9*i;
+        scalar* S = r + 6*i;
+        S[0] = T[0];
+        S[1] = 0.5*(T[1] + T[3]);
+        S[2] = 0.5*(T[2] + T[6]);
+        S[3] = T[4];
+        S[4] = 0.5*(T[5] + T[7]);
+        S[5] = T[8];
+    }
+}
+
+PYBFOAM_INLINE void dev2TensorLoop(const scalar* t, scalar* r, const label n)
+{
+    for (label i = 0; i < n; ++i)
+    {
+        const scalar* T = t + 9*i;
+        scalar* R = r + 9*i;
+        const scalar twoThirdsTr = (2.0/3.0)*(T[0] + T[4] + T[8]);
+        R[0] = T[0] - twoThirdsTr;
+        R[1] = T[1];
+        R[2] = T[2];
+        R[3] = T[3];
+        R[4] = T[4] - twoThirdsTr;
+        R[5] = T[5];
+        R[6] = T[6];
+        R[7] = T[7];
+        R[8] = T[8] - twoThirdsTr;
+    }
+}
+
+PYBFOAM_INLINE void dev2SymmTensorLoop
+(
+    const scalar* st, scalar* r, const label n
+)
+{
+    for (label i = 0; i < n; ++i)
+    {
+        const scalar* S = st + 6*i;
+        scalar* R = r + 6*i;
+        const scalar twoThirdsTr = (2.0/3.0)*(S[0] + S[3] + S[5]);
+        R[0] = S[0] - twoThirdsTr;
+        R[1] = S[1];
+        R[2] = S[2];
+        R[3] = S[3] - twoThirdsTr;
+        R[4] = S[4];
+        R[5] = S[5] - twoThirdsTr;
+    }
+}
+
+PYBFOAM_INLINE void doubleInnerLoop
+(
+    const scalar* t, const scalar* st, scalar* r, const label n
+)
+{
+    for (label i = 0; i < n; ++i)
+    {
+        const scalar* T = t + 9*i;
+        const scalar* S = st + 6*i;
+        r[i] =
+            T[0]*S[0] + T[1]*S[1] + T[2]*S[2]
+          + T[3]*S[1] + T[4]*S[3] + T[5]*S[4]
+          + T[6]*S[2] + T[7]*S[4] + T[8]*S[5];
+    }
+}
+
+
+#ifdef PYBFOAM_X86_SIMD
+
+// * * * * * * * * * * * * * * * * * AVX2  * * * * * * * * * * * * * * * * * //
+
+// 4 vectors = 12 scalars = 3 registers, split into x, y and z components
+PYBFOAM_AVX2 PYBFOAM_INLINE void load3Avx2
+(
+    const scalar* p, __m256d& x, __m256d& y, __m256d& z
+)
+{
+    const __m256d r0 = _mm256_loadu_pd(p);      // x0 y0 z0 x1
+    const __m256d r1 = _mm256_loadu_pd(p + 4);  // y1 z1 x2 y2
+    const __m256d r2 = _mm256_loadu_pd(p + 8);  // z2 x3 y3 z3
+
+    x = _mm256_permute4x64_pd
+    (
+        _mm256_blend_pd(_mm256_blend_pd(r0, r1, 0x4), r2, 0x2), 0x6C
+    );
+    y = _mm256_permute4x64_pd
+    (
+        _mm256_blend_pd(_mm256_blend_pd(r0, r1, 0x9), r2, 0x4), 0xB1
+    );
+    z = _mm256_permute4x64_pd
+    (
+        _mm256_blend_pd(_mm256_blend_pd(r0, r1, 0x2), r2, 0x9), 0xC6
+    );
+}
+
+PYBFOAM_AVX2 PYBFOAM_INLINE __m256d magSqrAvx2
+(
+    const __m256d x, const __m256d y, const __m256d z
+)
+{
+    return _mm256_add_pd
+    (
+        _mm256_add_pd(_mm256_mul_pd(x, x), _mm256_mul_pd(y, y)),
+        _mm256_mul_pd(z, z)
+    );
+}
+
+PYBFOAM_AVX2 void innerAvx2
+(
+    const scalar* a, const scalar* b, scalar* r, const label n
+)
+{
+    label i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d ax, ay, az, bx, by, bz;
+        load3Avx2(a + 3*i, ax, ay, az);
+        load3Avx2(b + 3*i, bx, by, bz);
+        const __m256d d = _mm256_add_pd
+        (
+            _mm256_add_pd(_mm256_mul_pd(ax, bx), _mm256_mul_pd(ay, by)),
+            _mm256_mul_pd(az, bz)
+        );
+        _mm256_storeu_pd(r + i, d);
+    }
+    innerLoop(a, b, r, i, n);
+}
+
+PYBFOAM_AVX2 void innerUniformAvx2
+(
+    const scalar* a, const scalar* v, scalar* r, const label n
+)
+{
+    const __m256d vx = _mm256_set1_pd(v[0]);
+    const __m256d vy = _mm256_set1_pd(v[1]);
+    const __m256d vz = _mm256_set1_pd(v[2]);
+
+    label i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d ax, ay, az;
+        load3Avx2(a + 3*i, ax, ay, az);
+        const __m256d d = _mm256_add_pd
+        (
+            _mm256_add_pd(_mm256_mul_pd(ax, vx), _mm256_mul_pd(ay, vy)),
+            _mm256_mul_pd(az, vz)
+        );
+        _mm256_storeu_pd(r + i, d);
+    }
+    innerUniformLoop(a, v, r, i, n);
+}
+
+PYBFOAM_AVX2 void magSqrVectorAvx2(const scalar* a, scalar* r, const label n)
+{
+    label i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d x, y, z;
+        load3Avx2(a + 3*i, x, y, z);
+        _mm256_storeu_pd(r + i, magSqrAvx2(x, y, z));
+    }
+    magSqrVectorLoop(a, r, i, n);
+}
+
+PYBFOAM_AVX2 void magVectorAvx2(const scalar* a, scalar* r, const label n)
+{
+    label i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        __m256d x, y, z;
+        load3Avx2(a + 3*i, x, y, z);
+        _mm256_storeu_pd(r + i, _mm256_sqrt_pd(magSqrAvx2(x, y, z)));
+    }
+    magVectorLoop(a, r, i, n);
+}
+
+// Spread s0..s3 to match the x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 layout
+#define PYBFOAM_SPREAD_AVX2(s, p0, p1, p2)                                     \
+    const __m256d p0 = _mm256_permute4x64_pd(s, 0x40);                         \
+    const __m256d p1 = _mm256_permute4x64_pd(s, 0xA5);                         \
+    const __m256d p2 = _mm256_permute4x64_pd(s, 0xFE);
+
+PYBFOAM_AVX2 void multiplyVectorAvx2
+(
+    const scalar* a, const scalar* s, scalar* r, const label n
+)
+{
+    label i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d si = _mm256_loadu_pd(s + i);
+        PYBFOAM_SPREAD_AVX2(si, p0, p1, p2)
+        const scalar* ai = a + 3*i;
+        scalar* ri = r + 3*i;
+        _mm256_storeu_pd(ri, _mm256_mul_pd(_mm256_loadu_pd(ai), p0));
+        _mm256_storeu_pd(ri + 4, _mm256_mul_pd(_mm256_loadu_pd(ai + 4), p1));
+        _mm256_storeu_pd(ri + 8, _mm256_mul_pd(_mm256_loadu_pd(ai + 8), p2));
+    }
+    multiplyVectorLoop(a, s, r, i, n);
+}
+
+PYBFOAM_AVX2 void divideVectorAvx2
+(
+    const scalar* a, const scalar* s, scalar* r, const label n
+)
+{
+    label i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d si = _mm256_loadu_pd(s + i);
+        PYBFOAM_SPREAD_AVX2(si, p0, p1, p2)
+        const scalar* ai = a + 3*i;
+        scalar* ri = r + 3*i;
+        _mm256_storeu_pd(ri, _mm256_div_pd(_mm256_loadu_pd(ai), p0));
+        _mm256_storeu_pd(ri + 4, _mm256_div_pd(_mm256_loadu_pd(ai + 4), p1));
+        _mm256_storeu_pd(ri + 8, _mm256_div_pd(_mm256_loadu_pd(ai + 8), p2));
+    }
+    divideVectorLoop(a, s, r, i, n);
+}
+
+#undef PYBFOAM_SPREAD_AVX2
+
+// Tensor kernels: nine or six strided streams per element, left to the
+// compiler's vectoriser with the wider instruction set enabled
+PYBFOAM_AVX2 void magSqrTensorAvx2(const scalar* t, scalar* r, const label n)
+{
+    magSqrTensorLoop(t, r, n);
+}
+
+PYBFOAM_AVX2 void magTensorAvx2(const scalar* t, scalar* r, const label n)
+{
+    magTensorLoop(t, r, n);
+}
+
+PYBFOAM_AVX2 void symmTensorOfTensorAvx2
+(
+    const scalar* t, scalar* r, const label n
+)
+{
+    symmTensorOfTensorLoop(t, r, n);
+}
+
+PYBFOAM_AVX2 void dev2TensorAvx2(const scalar* t, scalar* r, const label n)
+{
+    dev2TensorLoop(t, r, n);
+}
+
+PYBFOAM_AVX2 void dev2SymmTensorAvx2(const scalar* st, scalar* r, const label n)
+{
+    dev2SymmTensorLoop(st, r, n);
+}
+
+PYBFOAM_AVX2 void doubleInnerAvx2
+(
+    const scalar* t, const scalar* st, scalar* r, const label n
+)
+{
+    doubleInnerLoop(t, st, r, n);
+}
+
+
+// * * * * * * * * * * * * * * * * AVX-512 * * * * * * * * * * * * * * * * * //
+
+// 8 vectors = 24 scalars = 3 registers, split into x, y and z components
+PYBFOAM_AVX512 PYBFOAM_INLINE void load3Avx512
+(
+    const scalar* p, __m512d& x, __m512d& y, __m512d& z
+)
+{
+    // Indices into (r0, r1), then into (partial, r2)
+    alignas(64) static const long long xi0[8] = {0, 3, 6, 9, 12, 15, 0, 0};
+    alignas(64) static const long long xi1[8] = {0, 1, 2, 3, 4, 5, 10, 13};
+    alignas(64) static const long long yi0[8] = {1, 4, 7, 10, 13, 0, 0, 0};
+    alignas(64) static const long long yi1[8] = {0, 1, 2, 3, 4, 8, 11, 14};
+    alignas(64) static const long long zi0[8] = {2, 5, 8, 11, 14, 0, 0, 0};
+    alignas(64) static const long long zi1[8] = {0, 1, 2, 3, 4, 9, 12, 15};
+
+    const __m512d r0 = _mm512_loadu_pd(p);
+    const __m512d r1 = _mm512_loadu_pd(p + 8);
+    const __m512d r2 = _mm512_loadu_pd(p + 16);
+
+    x = _mm512_permutex2var_pd
+    (
+        _mm512_permutex2var_pd(r0, _mm512_load_si512(xi0), r1),
+        _mm512_load_si512(xi1),
+        r2
+    );
+    y = _mm512_permutex2var_pd
+    (
+        _mm512_permutex2var_pd(r0, _mm512_load_si512(yi0), r1),
+        _mm512_load_si512(yi1),
+        r2
+    );
+    z = _mm512_permutex2var_pd
+    (
+        _mm512_permutex2var_pd(r0, _mm512_load_si512(zi0), r1),
+        _mm512_load_si512(zi1),
+        r2
+    );
+}
+
+PYBFOAM_AVX512 PYBFOAM_INLINE __m512d magSqrAvx512
+(
+    const __m512d x, const __m512d y, const __m512d z
+)
+{
+    return _mm512_add_pd
+    (
+        _mm512_add_pd(_mm512_mul_pd(x, x), _mm512_mul_pd(y, y)),
+        _mm512_mul_pd(z, z)
+    );
+}
+
+PYBFOAM_AVX512 void innerAvx512
+(
+    const scalar* a, const scalar* b, scalar* r, const label n
+)
+{
+    label i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m512d ax, ay, az, bx, by, bz;
+        load3Avx512(a + 3*i, ax, ay, az);
+        load3Avx512(b + 3*i, bx, by, bz);
+        const __m512d d = _mm512_add_pd
+        (
+            _mm512_add_pd(_mm512_mul_pd(ax, bx), _mm512_mul_pd(ay, by)),
+            _mm512_mul_pd(az, bz)
+        );
+        _mm512_storeu_pd(r + i, d);
+    }
+    innerLoop(a, b, r, i, n);
+}
+
+PYBFOAM_AVX512 void innerUniformAvx512
+(
+    const scalar* a, const scalar* v, scalar* r, const label n
+)
+{
+    const __m512d vx = _mm512_set1_pd(v[0]);
+    const __m512d vy = _mm512_set1_pd(v[1]);
+    const __m512d vz = _mm512_set1_pd(v[2]);
+
+    label i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m512d ax, ay, az;
+        load3Avx512(a + 3*i, ax, ay, az);
+        const __m512d d = _mm512_add_pd
+        (
+            _mm512_add_pd(_mm512_mul_pd(ax, vx), _mm512_mul_pd(ay, vy)),
+            _mm512_mul_pd(az, vz)
+        );
+        _mm512_storeu_pd(r + i, d);
+    }
+    innerUniformLoop(a, v, r, i, n);
+}
+
+PYBFOAM_AVX512 void magSqrVectorAvx512(const scalar* a, scalar* r, const label n)
+{
+    label i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m512d x, y, z;
+        load3Avx512(a + 3*i, x, y, z);
+        _mm512_storeu_pd(r + i, magSqrAvx512(x, y, z));
+    }
+    magSqrVectorLoop(a, r, i, n);
+}
+
+PYBFOAM_AVX512 void magVectorAvx512(const scalar* a, scalar* r, const label n)
+{
+    label i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        __m512d x, y, z;
+        load3Avx512(a + 3*i, x, y, z);
+        _mm512_storeu_pd(r + i, _mm512_sqrt_pd(magSqrAvx512(x, y, z)));
+    }
+    magVectorLoop(a, r, i, n);
+}
+
+// Spread s0..s7 to match the interleaved layout of 8 vectors
+#define PYBFOAM_SPREAD_AVX512(s, p0, p1, p2)                                   \
+    alignas(64) static const long long si0[8] = {0, 0, 0, 1, 1, 1, 2, 2};      \
+    alignas(64) static const long long si1[8] = {2, 3, 3, 3, 4, 4, 4, 5};      \
+    alignas(64) static const long long si2[8] = {5, 5, 6, 6, 6, 7, 7, 7};      \
+    const __m512d p0 = _mm512_permutexvar_pd(_mm512_load_si512(si0), s);       \
+    const __m512d p1 = _mm512_permutexvar_pd(_mm512_load_si512(si1), s);       \
+    const __m512d p2 = _mm512_permutexvar_pd(_mm512_load_si512(si2), s);
+
+PYBFOAM_AVX512 void multiplyVectorAvx512
+(
+    const scalar* a, const scalar* s, scalar* r, const label n
+)
+{
+    label i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m512d si = _mm512_loadu_pd(s + i);
+        PYBFOAM_SPREAD_AVX512(si, p0, p1, p2)
+        const scalar* ai = a + 3*i;
+        scalar* ri = r + 3*i;
+        _mm512_storeu_pd(ri, _mm512_mul_pd(_mm512_loadu_pd(ai), p0));
+        _mm512_storeu_pd(ri + 8, _mm512_mul_pd(_mm512_loadu_pd(ai + 8), p1));
+        _mm512_storeu_pd(ri + 16, _mm512_mul_pd(_mm512_loadu_pd(ai + 16), p2));
+    }
+    multiplyVectorLoop(a, s, r, i, n);
+}
+
+PYBFOAM_AVX512 void divideVectorAvx512
+(
+    const scalar* a, const scalar* s, scalar* r, const label n
+)
+{
+    label i = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        const __m512d si = _mm512_loadu_pd(s + i);
+        PYBFOAM_SPREAD_AVX512(si, p0, p1, p2)
+        const scalar* ai = a + 3*i;
+        scalar* ri = r + 3*i;
+        _mm512_storeu_pd(ri, _mm512_div_pd(_mm512_loadu_pd(ai), p0));
+        _mm512_storeu_pd(ri + 8, _mm512_div_pd(_mm512_loadu_pd(ai + 8), p1));
+        _mm512_storeu_pd(ri + 16, _mm512_div_pd(_mm512_loadu_pd(ai + 16), p2));
+    }
+    divideVectorLoop(a, s, r, i, n);
+}
+
+#undef PYBFOAM_SPREAD_AVX512
+
+PYBFOAM_AVX512 void magSqrTensorAvx512(const scalar* t, scalar* r, const label n)
+{
+    magSqrTensorLoop(t, r, n);
+}
+
+PYBFOAM_AVX512 void magTensorAvx512(const scalar* t, scalar* r, const label n)
+{
+    magTensorLoop(t, r, n);
+}
+
+PYBFOAM_AVX512 void symmTensorOfTensorAvx512
+(
+    const scalar* t, scalar* r, const label n
+)
+{
+    symmTensorOfTensorLoop(t, r, n);
+}
+
+PYBFOAM_AVX512 void dev2TensorAvx512(const scalar* t, scalar* r, const label n)
+{
+    dev2TensorLoop(t, r, n);
+}
+
+PYBFOAM_AVX512 void dev2SymmTensorAvx512
+(
+    const scalar* st, scalar* r, const label n
+)
+{
+    dev2SymmTensorLoop(st, r, n);
+}
+
+PYBFOAM_AVX512 void doubleInnerAvx512
+(
+    const scalar* t, const scalar* st, scalar* r, const label n
+)
+{
+    doubleInnerLoop(t, st, r, n);
+}
+
+#endif
+
+
+// * * * * * * * * * * * * * * * * Dispatch  * * * * * * * * * * * * * * * * //
+
+static isa detect()
+{
+    #ifdef PYBFOAM_X86_SIMD
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return isa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return isa::avx2;
+    }
+    #endif
+    return isa::scalar;
+}
+
+static std::atomic<isa>& activeIsa()
+{
+    static std::atomic<isa> i(detected());
+    return i;
+}
+
+isa detected()
+{
+    static const isa i = detect();
+    return i;
+}
+
+isa active()
+{
+    return activeIsa().load(std::memory_order_relaxed);
+}
+
+void setActive(const isa i)
+{
+    activeIsa() = std::min(i, detected());
+}
+
+word name(const isa i)
+{
+    switch (i)
+    {
+        case isa::avx512: return "avx512";
+        case isa::avx2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+isa fromName(const word& name)
+{
+    for (const isa i : {isa::scalar, isa::avx2, isa::avx512})
+    {
+        if (simd::name(i) == name)
+        {
+            return i;
+        }
+    }
+    throw std::runtime_error
+    (
+        "Unknown instruction set " + name + ", expected scalar, avx2 or avx512"
+    );
+}
+
+
+#ifdef PYBFOAM_X86_SIMD
+    #define PYBFOAM_DISPATCH(kernel, portable, ...)                            \
+        switch (active())                                                      \
+        {                                                                      \
+            case isa::avx512: kernel##Avx512(__VA_ARGS__); return;             \
+            case isa::avx2: kernel##Avx2(__VA_ARGS__); return;                 \
+            default: portable; return;                                         \
+        }
+#else
+    #define PYBFOAM_DISPATCH(kernel, portable, ...) portable;
+#endif
+
+
+void inner(const scalar* a, const scalar* b, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(inner, innerLoop(a, b, r, 0, n), a, b, r, n)
+}
+
+void innerUniform(const scalar* a, const scalar* b, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(innerUniform, innerUniformLoop(a, b, r, 0, n), a, b, r, n)
+}
+
+void magSqrVector(const scalar* a, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(magSqrVector, magSqrVectorLoop(a, r, 0, n), a, r, n)
+}
+
+void magVector(const scalar* a, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(magVector, magVectorLoop(a, r, 0, n), a, r, n)
+}
+
+void multiplyVector(const scalar* a, const scalar* s, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(multiplyVector, multiplyVectorLoop(a, s, r, 0, n), a, s, r, n)
+}
+
+void divideVector(const scalar* a, const scalar* s, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(divideVector, divideVectorLoop(a, s, r, 0, n), a, s, r, n)
+}
+
+void magSqrTensor(const scalar* t, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(magSqrTensor, magSqrTensorLoop(t, r, n), t, r, n)
+}
+
+void magTensor(const scalar* t, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(magTensor, magTensorLoop(t, r, n), t, r, n)
+}
+
+void symmTensorOfTensor(const scalar* t, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(symmTensorOfTensor, symmTensorOfTensorLoop(t, r, n), t, r, n)
+}
+
+void dev2Tensor(const scalar* t, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(dev2Tensor, dev2TensorLoop(t, r, n), t, r, n)
+}
+
+void dev2SymmTensor(const scalar* st, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(dev2SymmTensor, dev2SymmTensorLoop(st, r, n), st, r, n)
+}
+
+void doubleInner(const scalar* t, const scalar* st, scalar* r, const label n)
+{
+    PYBFOAM_DISPATCH(doubleInner, doubleInnerLoop(t, st, r, n), t, st, r, n)
+}
+
+#undef PYBFOAM_DISPATCH
+
+} // End namespace simd
+} // End namespace Foam
@@ -0,0 +1,108 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+    SIMD kernels for the hot vector and tensor field operations.
+
+    The kernels work on the raw array-of-structures storage of a Field, i.e.
+    3 (vector), 6 (symmTensor) or 9 (tensor) consecutive scalars per element.
+    Each has a portable implementation and, when built with PYBFOAM_SIMD on
+    x86-64 in double precision, AVX2 and AVX-512 variants. The widest
+    variant supported by the CPU is selected at runtime.
+
+    All variants evaluate the same operations in the same order as the
+    OpenFOAM primitives (no FMA contraction), so results are bitwise
+    identical whichever instruction set is used.
+
+SourceFiles
+    simdKernels.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_simdKernels
+#define foam_simdKernels
+
+#include "scalar.H"
+#include "label.H"
+#include "word.H"
+
+namespace Foam
+{
+namespace simd
+{
+
+enum class isa { scalar, avx2, avx512 };
+
+//- Widest instruction set supported by this build and CPU
+isa detected();
+
+//- Instruction set used by the kernels
+isa active();
+
+//- Select the instruction set, limited to detected(); for benchmarking
+void setActive(const isa i);
+
+word name(const isa i);
+
+isa fromName(const word& name);
+
+
+// Vector kernels, a and b hold 3*n scalars
+
+//- r[i] = a[i] & b[i]
+void inner(const scalar* a, const scalar* b, scalar* r, const label n);
+
+//- r[i] = a[i] & b, b holds 3 scalars
+void innerUniform(const scalar* a, const scalar* b, scalar* r, const label n);
+
+//- r[i] = magSqr(a[i])
+void magSqrVector(const scalar* a, scalar* r, const label n);
+
+//- r[i] = mag(a[i])
+void magVector(const scalar* a, scalar* r, const label n);
+
+//- r[i] = a[i]*s[i]
+void multiplyVector(const scalar* a, const scalar* s, scalar* r, const label n);
+
+//- r[i] = a[i]/s[i]
+void divideVector(const scalar* a, const scalar* s, scalar* r, const label n);
+
+
+// Tensor kernels, t holds 9*n and st 6*n scalars
+
+//- r[i] = magSqr(t[i])
+void magSqrTensor(const scalar* t, scalar* r, const label n);
+
+//- r[i] = mag(t[i])
+void magTensor(const scalar* t, scalar* r, const label n);
+
+//- r[i] = symm(t[i]), r holds 6*n scalars
+void symmTensorOfTensor(const scalar* t, scalar* r, const label n);
+
+//- r[i] = dev2(t[i])
+void dev2Tensor(const scalar* t, scalar* r, const label n);
+
+//- r[i] = dev2(st[i])
+void dev2SymmTensor(const scalar* st, scalar* r, const label n);
+
+//- r[i] = t[i] && st[i]
+void doubleInner(const scalar* t, const scalar* st, scalar* r, const label n);
+
+} // End namespace simd
+} // End namespace Foam
+
+#endif
@@ -0,0 +1,275 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "solveTelemetry.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace
+{
+
+static_assert
+(
+    sizeof(Foam::solveTelemetry::record) == 48,
+    "solveTelemetry::record is written as is"
+);
+
+//- Records sent to the writer thread at once
+constexpr size_t blockSize = 256;
+
+} // End anonymous namespace
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::solveTelemetry::solveTelemetry()
+:
+    enabled_(false),
+    names_(),
+    nameIds_(),
+    buffer_(),
+    nRecorded_(0),
+    pending_(),
+    block_(),
+    newNames_(),
+    nNamesWritten_(0),
+    writer_(*this, "solve telemetry")
+{}
+
+
+// * * * * * * * * * * * * * * * * Selectors * * * * * * * * * * * * * * * * //
+
+Foam::solveTelemetry& Foam::solveTelemetry::instance()
+{
+    static solveTelemetry telemetry;
+    return telemetry;
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+int32_t Foam::solveTelemetry::nameId(const word& name)
+{
+    const auto iter = nameIds_.find(name);
+    if (iter != nameIds_.end())
+    {
+        return iter->second;
+    }
+
+    const int32_t id = int32_t(names_.size());
+    names_.push_back(name);
+    nameIds_.emplace(name, id);
+    return id;
+}
+
+
+void Foam::solveTelemetry::add
+(
+    const word& fieldName,
+    const word& solverName,
+    const scalar time,
+    const double wallTime,
+    const label nIterations,
+    const scalar initialResidual,
+    const scalar finalResidual,
+    const bool converged
+)
+{
+    bool wakeWriter = false;
+    {
+        std::lock_guard<std::mutex> lock(writer_.mutex());
+
+        if (buffer_.empty())
+        {
+            return;
+        }
+
+        record& rec = buffer_[nRecorded_ % int64_t(buffer_.size())];
+        rec.time = time;
+        rec.wallTime = wallTime;
+        rec.initialResidual = initialResidual;
+        rec.finalResidual = finalResidual;
+        rec.field = nameId(fieldName);
+        rec.solver = nameId(solverName);
+        rec.nIterations = int32_t(nIterations);
+        rec.converged = converged;
+        ++nRecorded_;
+
+        if (writer_.isOpen() && !writer_.failed())
+        {
+            pending_.push_back(rec);
+            wakeWriter = pending_.size() >= blockSize;
+        }
+    }
+
+    if (wakeWriter)
+    {
+        writer_.notify();
+    }
+}
+
+
+bool Foam::solveTelemetry::blockReady() const
+{
+    return pending_.size() >= blockSize;
+}
+
+
+void Foam::solveTelemetry::takeBlock()
+{
+    block_.swap(pending_);
+    newNames_.assign(names_.begin() + nNamesWritten_, names_.end());
+}
+
+
+void Foam::solveTelemetry::writeBlock(std::ostream& os)
+{
+    for (const std::string& name : newNames_)
+    {
+        writeInt64(os, 0);
+        writeInt64(os, int64_t(nNamesWritten_++));
+        writeInt64(os, int64_t(name.size()));
+        os.write(name.data(), std::streamsize(name.size()));
+    }
+
+    if (!block_.empty())
+    {
+        writeInt64(os, 1);
+        writeInt64(os, int64_t(block_.size()));
+        os.write
+        (
+            reinterpret_cast<const char*>(block_.data()),
+            std::streamsize(block_.size()*sizeof(record))
+        );
+    }
+
+    block_.clear();
+}
+
+
+bool Foam::solveTelemetry::pending() const
+{
+    return !pending_.empty();
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void Foam::solveTelemetry::enable(const label capacity)
+{
+    if (capacity < 1)
+    {
+        throw std::runtime_error("solve telemetry capacity must be at least 1");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(writer_.mutex());
+
+        // Keep the latest records when resizing
+        std::vector<record> buffer(size_t(capacity), record());
+        const int64_t nKeep =
+            std::min<int64_t>
+            (
+                std::min<int64_t>(nRecorded_, int64_t(buffer_.size())),
+                capacity
+            );
+        for (int64_t i = 0; i < nKeep; ++i)
+        {
+            buffer[i] =
+                buffer_[(nRecorded_ - nKeep + i) % int64_t(buffer_.size())];
+        }
+        buffer_.swap(buffer);
+        nRecorded_ = nKeep;
+    }
+
+    enabled_.store(true, std::memory_order_relaxed);
+}
+
+
+void Foam::solveTelemetry::disable()
+{
+    enabled_.store(false, std::memory_order_relaxed);
+}
+
+
+void Foam::solveTelemetry::clear()
+{
+    std::lock_guard<std::mutex> lock(writer_.mutex());
+    nRecorded_ = 0;
+}
+
+
+Foam::label Foam::solveTelemetry::size() const
+{
+    std::lock_guard<std::mutex> lock(writer_.mutex());
+    return label(std::min<int64_t>(nRecorded_, int64_t(buffer_.size())));
+}
+
+
+std::vector<Foam::solveTelemetry::record>
+Foam::solveTelemetry::records() const
+{
+    std::lock_guard<std::mutex> lock(writer_.mutex());
+
+    const int64_t n = std::min<int64_t>(nRecorded_, int64_t(buffer_.size()));
+    std::vector<record> result(size_t(n));
+    for (int64_t i = 0; i < n; ++i)
+    {
+        result[i] = buffer_[(nRecorded_ - n + i) % int64_t(buffer_.size())];
+    }
+    return result;
+}
+
+
+std::vector<std::string> Foam::solveTelemetry::names() const
+{
+    std::lock_guard<std::mutex> lock(writer_.mutex());
+    return names_;
+}
+
+
+void Foam::solveTelemetry::open(const std::string& path)
+{
+    if (!writer_.isOpen())
+    {
+        std::lock_guard<std::mutex> lock(writer_.mutex());
+        pending_.clear();
+        nNamesWritten_ = 0;
+    }
+
+    writer_.open(path, [](std::ostream& os){ os.write("PYBFSLV1", 8); });
+}
+
+
+void Foam::solveTelemetry::flush()
+{
+    writer_.flush();
+}
+
+
+void Foam::solveTelemetry::close()
+{
+    writer_.close();
+}
+
+
+// ************************************************************************* //
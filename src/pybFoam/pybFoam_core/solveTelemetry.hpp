@@ -0,0 +1,237 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::solveTelemetry
+
+Description
+    Opt-in recorder of every linear solve started from Python
+    (fvMatrix.solve, solve, solve_all): field, solver, wall time,
+    iterations and the largest component residuals.
+
+    The latest capacity records are kept in memory. With a file (open)
+    all records are appended by a background thread (asyncBinaryWriter)
+    in blocks, so the solves never wait for the disk.
+
+    File layout (native byte order), read by
+    pybFoam.telemetry.read_solve_telemetry:
+
+        "PYBFSLV1"
+        entries starting with an int64 kind:
+          0 name:    int64 id, int64 size, name
+          1 records: int64 n, n records of the layout of record (48 bytes)
+
+    A name entry precedes the first record using it.
+
+SourceFiles
+    solveTelemetry.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_solveTelemetry
+#define foam_solveTelemetry
+
+#include "fvMatrix.H"
+#include "asyncBinaryWriter.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Foam
+{
+
+class solveTelemetry
+:
+    public asyncBinaryWriter::source
+{
+public:
+
+    //- One solve, components reduced to their maximum
+    struct record
+    {
+        double time;
+        double wallTime;
+        double initialResidual;
+        double finalResidual;
+        int32_t field;
+        int32_t solver;
+        int32_t nIterations;
+        int32_t converged;
+    };
+
+
+private:
+
+    // Private Data
+
+        std::atomic<bool> enabled_;
+
+        //- Field and solver names, indexed by record::field/solver
+        std::vector<std::string> names_;
+        std::unordered_map<std::string, int32_t> nameIds_;
+
+        //- Ring buffer of the latest records
+        std::vector<record> buffer_;
+        int64_t nRecorded_;
+
+        //- Records not yet handed to the writer thread
+        std::vector<record> pending_;
+
+        //- Records and names taken by the writer thread, only used by it
+        std::vector<record> block_;
+        std::vector<std::string> newNames_;
+        size_t nNamesWritten_;
+
+        //- Its mutex guards the names, records and pending_
+        asyncBinaryWriter writer_;
+
+
+    // Private Member Functions
+
+        solveTelemetry();
+
+        int32_t nameId(const word& name);
+
+        // asyncBinaryWriter::source
+
+            bool blockReady() const override;
+            void takeBlock() override;
+            void writeBlock(std::ostream& os) override;
+            bool pending() const override;
+
+        void add
+        (
+            const word& fieldName,
+            const word& solverName,
+            const scalar time,
+            const double wallTime,
+            const label nIterations,
+            const scalar initialResidual,
+            const scalar finalResidual,
+            const bool converged
+        );
+
+
+public:
+
+    solveTelemetry(const solveTelemetry&) = delete;
+    void operator=(const solveTelemetry&) = delete;
+
+    static solveTelemetry& instance();
+
+
+    // Member Functions
+
+        bool enabled() const noexcept
+        {
+            return enabled_.load(std::memory_order_relaxed);
+        }
+
+        //- Start recording, keeping the latest capacity records in memory
+        void enable(const label capacity);
+
+        //- Stop recording, the records and the file are kept
+        void disable();
+
+        //- Forget the records in memory
+        void clear();
+
+        //- Number of records in memory
+        label size() const;
+
+        //- Records in memory, oldest first
+        std::vector<record> records() const;
+
+        std::vector<std::string> names() const;
+
+        //- Stream all further records to a binary file
+        void open(const std::string& path);
+
+        //- Wait until all records are written
+        void flush();
+
+        //- Write the pending records and close the file
+        void close();
+
+        //- Record a solve
+        template<class Type>
+        void add
+        (
+            const SolverPerformance<Type>& perf,
+            const scalar time,
+            const double wallTime
+        )
+        {
+            label nIterations = 0;
+            scalar initialResidual = 0;
+            scalar finalResidual = 0;
+            for (direction cmpt = 0; cmpt < pTraits<Type>::nComponents; ++cmpt)
+            {
+                nIterations =
+                    max(nIterations, component(perf.nIterations(), cmpt));
+                initialResidual =
+                    max(initialResidual, component(perf.initialResidual(), cmpt));
+                finalResidual =
+                    max(finalResidual, component(perf.finalResidual(), cmpt));
+            }
+
+            add
+            (
+                perf.fieldName(),
+                perf.solverName(),
+                time,
+                wallTime,
+                nIterations,
+                initialResidual,
+                finalResidual,
+                perf.converged()
+            );
+        }
+};
+
+
+//- Call solve() and record its SolverPerformance if telemetry is enabled
+template<class Type, class Solve>
+SolverPerformance<Type> recordSolve(const fvMatrix<Type>& matrix, Solve&& solve)
+{
+    solveTelemetry& telemetry = solveTelemetry::instance();
+    if (!telemetry.enabled())
+    {
+        return solve();
+    }
+
+    // Solving a tmp may clear the matrix
+    const scalar time = matrix.psi().mesh().time().value();
+
+    const auto start = std::chrono::steady_clock::now();
+    SolverPerformance<Type> perf = solve();
+    const std::chrono::duration<double> wallTime =
+        std::chrono::steady_clock::now() - start;
+
+    telemetry.add(perf, time, wallTime.count());
+
+    return perf;
+}
+
+} // End namespace Foam
+
+#endif
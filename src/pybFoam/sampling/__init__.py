@@ -8,6 +8,7 @@ from __future__ import annotations
 
 from pybFoam.sampling_bindings import *  # noqa: F403
 
+from .probes import ProbeData, read_probes
 from .set_configs import (
     ArraySetConfig,
     CellCentreSetConfig,
@@ -37,6 +38,13 @@ from .surface_configs import (
     SampledThresholdCellFacesConfig,
     sampled_surface_from,
 )
+from .surface_stream import (
+    SurfaceFrame,
+    SurfaceGeometryData,
+    SurfaceStream,
+    SurfaceStreamData,
+    read_surface_stream,
+)
 from .utils import dict_to_foam
 
 __all__ = [
@@ -65,6 +73,15 @@ __all__ = [
     "CellCentreSetConfig",
     "PatchCloudSetConfig",
     "PatchSeedSetConfig",
+    # Probe files
+    "ProbeData",
+    "read_probes",
+    # Surface streams
+    "SurfaceStream",
+    "SurfaceStreamData",
+    "SurfaceGeometryData",
+    "SurfaceFrame",
+    "read_surface_stream",
     # Helper functions
     "sampled_surface_from",
     "sampled_set_from",
@@ -18,10 +18,20 @@ License
 \*---------------------------------------------------------------------------*/
 
 #include "bind_sampling.hpp"
+#include "arrayExport.hpp"
+#include "sampleSetWeights.hpp"
+#include "meshSearchBatch.hpp"
+#include "probeStream.hpp"
+#include "surfaceGeometry.hpp"
+#include "bind_fields.hpp"
 #include "volFields.H"
 #include "surfaceFields.H"
 #include "fvMesh.H"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace Foam
 {
 
@@ -68,6 +78,38 @@ void bindSampledSurface(nb::module_& m)
             "Get total surface area")
         .def("hasFaceIds", &sampledSurface::hasFaceIds,
             "Check if element ids/order of original surface are available")
+        .def("pointsArray",
+            [](nb::handle self) {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const sampledSurface&>(self).points(), self
+                );
+            },
+            "Points (nPoints, 3), read-only view until the next update")
+        .def("CfArray",
+            [](nb::handle self) {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const sampledSurface&>(self).Cf(), self
+                );
+            },
+            "Face centres (nFaces, 3), read-only view until the next update")
+        .def("SfArray",
+            [](nb::handle self) {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const sampledSurface&>(self).Sf(), self
+                );
+            },
+            "Face area vectors (nFaces, 3), read-only view until the next update")
+        .def("magSfArray",
+            [](nb::handle self) {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const sampledSurface&>(self).magSf(), self
+                );
+            },
+            "Face areas, read-only view until the next update")
         // .def_static("New",
         //     [](const word& name, const fvMesh& mesh, const dictionary& dict) {
         //         return sampledSurface::New(name, mesh, dict).release();
@@ -93,6 +135,40 @@ void bindSampledSurface(nb::module_& m)
             "Construct a new sampledSurface from dictionary (fvMesh overload)");
 }
 
+void bindSurfaceGeometry(nb::module_& m)
+{
+    nb::class_<surfaceGeometry>(m, "surfaceGeometry")
+        .def(nb::init<sampledSurface&>(),
+            nb::arg("surface"),
+            nb::keep_alive<1, 2>(),
+            "Face connectivity of the surface, kept across updates")
+        .def("update", &surfaceGeometry::update,
+            "Update the surface, True if its geometry changed since the last\n"
+            "call (always on the first call, never again for invariant surfaces)")
+        .def("version", &surfaceGeometry::version,
+            "Number of geometry changes seen by update()")
+        .def("points",
+            [](nb::handle self) {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const surfaceGeometry&>(self).surface().points(), self
+                );
+            },
+            "Surface points (nPoints, 3), read-only view until the next update")
+        .def("facesCSR",
+            [](nb::handle self) {
+                const surfaceGeometry& geometry = nb::cast<const surfaceGeometry&>(self);
+                return std::make_pair
+                (
+                    arrayExport::numpyConstView(geometry.faceOffsets()),
+                    arrayExport::numpyConstView(geometry.facePoints())
+                );
+            },
+            "(offsets, pointLabels) of the faces, face i is\n"
+            "pointLabels[offsets[i]:offsets[i + 1]]. The arrays keep the faces of\n"
+            "this geometry version, later updates do not modify them");
+}
+
 void bindMeshSearch(nb::module_& m)
 {
     nb::class_<meshSearch>(m, "meshSearch")
@@ -103,6 +179,7 @@ void bindMeshSearch(nb::module_& m)
             "Construct from fvMesh")
         .def("findNearestCell",
             [](const meshSearch& self, const point& location, label seedCelli, bool useTreeSearch) {
+                checkSeeds(self, labelUList(&seedCelli, 1));
                 return self.findNearestCell(location, seedCelli, useTreeSearch);
             },
             nb::arg("location"),
@@ -111,12 +188,61 @@ void bindMeshSearch(nb::module_& m)
             "Find nearest cell to location")
         .def("findCell",
             [](const meshSearch& self, const point& location, label seedCelli, bool useTreeSearch) {
+                checkSeeds(self, labelUList(&seedCelli, 1));
                 return self.findCell(location, seedCelli, useTreeSearch);
             },
             nb::arg("location"),
             nb::arg("seedCelli") = -1,
             nb::arg("useTreeSearch") = true,
-            "Find cell containing location");
+            "Find cell containing location")
+        .def("findCells",
+            [](const meshSearch& self, const scalarArray& points,
+               std::optional<labelArray> seeds, bool useTreeSearch) {
+                const label n = checkArrayShape<vector>(points);
+                const UList<point> pts
+                (
+                    reinterpret_cast<point*>(const_cast<scalar*>(points.data())), n
+                );
+                if (seeds && (seeds->ndim() != 1 || label(seeds->shape(0)) != n))
+                {
+                    throw std::runtime_error("Expected one seed per point");
+                }
+                const UList<label> seedList =
+                    seeds
+                  ? UList<label>(const_cast<label*>(seeds->data()), n)
+                  : UList<label>();
+                checkSeeds(self, seedList);
+
+                labelList cells;
+                {
+                    nb::gil_scoped_release release;
+                    cells = findCells(self, pts, seedList, useTreeSearch);
+                }
+                return arrayExport::numpyArray(std::move(cells));
+            },
+            nb::arg("points"),
+            nb::arg("seeds") = nb::none(),
+            nb::arg("useTreeSearch") = true,
+            "Cells containing the (N, 3) points, -1 outside the mesh. Optional\n"
+            "seeds give a start cell per point (-1: none), other values must be\n"
+            "cells of the mesh")
+        .def("findNearestCells",
+            [](const meshSearch& self, const scalarArray& points) {
+                const label n = checkArrayShape<vector>(points);
+                const UList<point> pts
+                (
+                    reinterpret_cast<point*>(const_cast<scalar*>(points.data())), n
+                );
+
+                labelList cells;
+                {
+                    nb::gil_scoped_release release;
+                    cells = findNearestCells(self, pts);
+                }
+                return arrayExport::numpyArray(std::move(cells));
+            },
+            nb::arg("points"),
+            "Cells with the centre nearest to the (N, 3) points");
 }
 
 void bindSampledSet(nb::module_& m)
@@ -175,6 +301,14 @@ void bindSampledSet(nb::module_& m)
             nb::arg("searchEngine"),
             nb::arg("dict"),
             "Construct a new sampledSet from dictionary");
+
+    nb::class_<sampleSetWeights>(m, "sampleSetWeights")
+        .def(nb::init<const sampledSet&>(),
+            nb::arg("sampledSet"),
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Precompute the interpolation weights of the set points (static mesh)")
+        .def("size", &sampleSetWeights::size,
+            "Number of sample points");
 }
 
 void bindInterpolation(nb::module_& m)
@@ -240,8 +374,168 @@ void bindInterpolation(nb::module_& m)
             "Create symmTensor interpolation scheme");
 }
 
+namespace
+{
+
+// One requested field of sampleFields
+template<class Type>
+struct fieldSample
+{
+    nb::object name;
+    const interpolation<Type>* interpolator;
+    List<Type> values;
+};
+
+// Requested fields grouped by type
+struct fieldSamples
+{
+    std::vector<fieldSample<scalar>> scalars;
+    std::vector<fieldSample<vector>> vectors;
+    std::vector<fieldSample<symmTensor>> symmTensors;
+    std::vector<fieldSample<tensor>> tensors;
+
+    template<class Func>
+    void forAllTypes(const Func& f)
+    {
+        f(scalars);
+        f(vectors);
+        f(symmTensors);
+        f(tensors);
+    }
+};
+
+
+template<class Type>
+bool addSample
+(
+    std::vector<fieldSample<Type>>& samples,
+    nb::handle name,
+    nb::handle interpolator
+)
+{
+    const interpolation<Type>* interp = nullptr;
+    if (!nb::try_cast<const interpolation<Type>*>(interpolator, interp) || !interp)
+    {
+        return false;
+    }
+    samples.push_back({nb::borrow(name), interp, List<Type>()});
+    return true;
+}
+
+
+// Cells the faces of a plane were cut from, nullptr for surfaces that
+// sample differently (patches, iso-surfaces, subsetted meshes, ...)
+const labelList* planeCells(const sampledSurface& surface)
+{
+    if (const auto* plane = isA<sampledPlane>(surface))
+    {
+        return &plane->meshCells();
+    }
+    return nullptr;
+}
+
+
+// Interpolate every field at the face centres in a single pass over the
+// faces, the same values sampledPlane::sample gives
+void samplePlaneFaces
+(
+    const sampledSurface& surface,
+    const labelList& meshCells,
+    fieldSamples& samples
+)
+{
+    const vectorField& Cf = surface.Cf();
+    const label nFaces = Cf.size();
+
+    samples.forAllTypes([&](auto& group)
+    {
+        for (auto& sample : group)
+        {
+            sample.values.resize(nFaces);
+        }
+    });
+
+    for (label facei = 0; facei < nFaces; ++facei)
+    {
+        const point& pt = Cf[facei];
+        const label celli = meshCells[facei];
+
+        samples.forAllTypes([&](auto& group)
+        {
+            for (auto& sample : group)
+            {
+                sample.values[facei] = sample.interpolator->interpolate(pt, celli);
+            }
+        });
+    }
+}
+
+} // End anonymous namespace
+
+
 void bindSamplingFunctions(nb::module_& m)
 {
+    m.def("sampleFields",
+        [](const sampledSurface& surface, const nb::dict& interpolators) {
+            nb::dict result;
+            fieldSamples samples;
+            for (auto [name, interp] : interpolators)
+            {
+                if
+                (
+                    !addSample(samples.scalars, name, interp)
+                 && !addSample(samples.vectors, name, interp)
+                 && !addSample(samples.symmTensors, name, interp)
+                 && !addSample(samples.tensors, name, interp)
+                )
+                {
+                    throw nb::type_error
+                    (
+                        ("unsupported interpolator for field "
+                        + nb::cast<std::string>(nb::str(name))).c_str()
+                    );
+                }
+                result[name] = nb::none();  // keeps the order of the request
+            }
+
+            const labelList* meshCells = planeCells(surface);
+            {
+                nb::gil_scoped_release release;
+                if (meshCells)
+                {
+                    samplePlaneFaces(surface, *meshCells, samples);
+                }
+                else
+                {
+                    samples.forAllTypes([&](auto& group)
+                    {
+                        for (auto& sample : group)
+                        {
+                            sample.values.transfer
+                            (
+                                surface.sample(*sample.interpolator).ref()
+                            );
+                        }
+                    });
+                }
+            }
+
+            samples.forAllTypes([&](auto& group)
+            {
+                for (auto& sample : group)
+                {
+                    result[sample.name] =
+                        arrayExport::numpyArray(std::move(sample.values));
+                }
+            });
+            return result;
+        },
+        nb::arg("surface"),
+        nb::arg("interpolators"),
+        "Sample several fields onto the surface faces in one pass.\n"
+        "interpolators maps names to interpolation objects, the result maps\n"
+        "the same names to NumPy arrays of the face values");
+
     // Scalar field sampling
     m.def("sampleOnFacesScalar",
         [](const sampledSurface& surface, const interpolation<scalar>& interpolator) {
@@ -423,6 +717,162 @@ void bindSamplingFunctions(nb::module_& m)
         nb::arg("sampledSet"),
         nb::arg("interpolator"),
         "Sample symmTensor field values onto sampledSet points");
+
+    // sampleSet functions with cached weights, run without the GIL
+    m.def("sampleSetScalar",
+        [](const sampleSetWeights& weights, const interpolation<scalar>& interpolator) -> scalarField {
+            nb::gil_scoped_release release;
+            return scalarField(weights.sample(interpolator));
+        },
+        nb::arg("weights"),
+        nb::arg("interpolator"),
+        "Sample scalar field values using precomputed weights, threaded");
+
+    m.def("sampleSetVector",
+        [](const sampleSetWeights& weights, const interpolation<vector>& interpolator) -> vectorField {
+            nb::gil_scoped_release release;
+            return vectorField(weights.sample(interpolator));
+        },
+        nb::arg("weights"),
+        nb::arg("interpolator"),
+        "Sample vector field values using precomputed weights, threaded");
+
+    m.def("sampleSetTensor",
+        [](const sampleSetWeights& weights, const interpolation<tensor>& interpolator) -> tensorField {
+            nb::gil_scoped_release release;
+            return tensorField(weights.sample(interpolator));
+        },
+        nb::arg("weights"),
+        nb::arg("interpolator"),
+        "Sample tensor field values using precomputed weights, threaded");
+
+    m.def("sampleSetSymmTensor",
+        [](const sampleSetWeights& weights, const interpolation<symmTensor>& interpolator) -> symmTensorField {
+            nb::gil_scoped_release release;
+            return symmTensorField(weights.sample(interpolator));
+        },
+        nb::arg("weights"),
+        nb::arg("interpolator"),
+        "Sample symmTensor field values using precomputed weights, threaded");
+}
+
+namespace
+{
+
+// NumPy array owning the values
+nb::ndarray<nb::numpy, double> ownedArray
+(
+    std::vector<double>&& values,
+    std::vector<size_t> shape
+)
+{
+    auto* owned = new std::vector<double>(std::move(values));
+    nb::capsule owner(owned, [](void* p) noexcept {
+        delete static_cast<std::vector<double>*>(p);
+    });
+    return nb::ndarray<nb::numpy, double>
+    (
+        owned->data(), shape.size(), shape.data(), owner
+    );
+}
+
+template<class FieldType>
+void bindProbesAdd(nb::class_<probeStream>& cls)
+{
+    cls.def("add",
+        [](probeStream& self, const std::string& name, const FieldType& field) {
+            self.add(word(name), field);
+        },
+        nb::arg("name"),
+        nb::arg("field"),
+        nb::keep_alive<1, 3>(),
+        "Add a field to sample, before open() and record()");
+}
+
+} // End anonymous namespace
+
+void bindProbes(nb::module_& m)
+{
+    nb::class_<probeStream> cls(m, "Probes");
+
+    cls.def("__init__",
+            [](probeStream* self, const fvMesh& mesh, const scalarArray& points,
+               const std::string& scheme, label capacity) {
+                const label n = checkArrayShape<vector>(points);
+                const UList<point> pts
+                (
+                    reinterpret_cast<point*>(const_cast<scalar*>(points.data())), n
+                );
+                nb::gil_scoped_release release;
+                new (self) probeStream(mesh, pts, word(scheme), capacity);
+            },
+            nb::arg("mesh"),
+            nb::arg("points"),
+            nb::arg("scheme") = "cellPoint",
+            nb::arg("capacity") = 1024,
+            nb::keep_alive<1, 2>(),
+            "Probes at the (N, 3) points, located once. Up to capacity time\n"
+            "steps are kept in memory")
+        .def("nProbes", &probeStream::nProbes,
+            "Number of probes")
+        .def("cells",
+            [](nb::handle self) {
+                return arrayExport::numpyConstView
+                (
+                    nb::cast<const probeStream&>(self).cells(), self
+                );
+            },
+            "Cell of every probe, -1 outside the mesh (values are then the\n"
+            "largest representable value)")
+        .def("capacity", &probeStream::capacity,
+            "Number of time steps held in memory")
+        .def("nRecorded", &probeStream::nRecorded,
+            "Number of time steps recorded so far");
+
+    bindProbesAdd<volScalarField>(cls);
+    bindProbesAdd<volVectorField>(cls);
+    bindProbesAdd<volSymmTensorField>(cls);
+    bindProbesAdd<volTensorField>(cls);
+
+    cls.def("open", &probeStream::open,
+            nb::arg("path"),
+            "Stream all time steps to a binary file (read with read_probes),\n"
+            "starting with the ones still in memory")
+        .def("record", &probeStream::record,
+            nb::arg("time"),
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Sample all fields at this time step")
+        .def("flush", &probeStream::flush,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Wait until all recorded time steps are written")
+        .def("close", &probeStream::close,
+            nb::call_guard<nb::gil_scoped_release>(),
+            "Write the pending time steps and close the file")
+        .def("times",
+            [](const probeStream& self) {
+                std::vector<double> times = self.bufferedTimes();
+                const size_t n = times.size();
+                return ownedArray(std::move(times), {n});
+            },
+            "Times of the time steps in memory, oldest first")
+        .def("values",
+            [](const probeStream& self, const std::string& name) {
+                label nComponents = 1;
+                std::vector<double> values = self.bufferedValues(name, nComponents);
+
+                std::vector<size_t> shape
+                {
+                    size_t(self.nBuffered()), size_t(self.nProbes())
+                };
+                if (nComponents > 1)
+                {
+                    shape.push_back(size_t(nComponents));
+                }
+                return ownedArray(std::move(values), std::move(shape));
+            },
+            nb::arg("name"),
+            "Values of a field at the time steps in memory, oldest first,\n"
+            "shape (nSteps, nProbes) or (nSteps, nProbes, nComponents)");
 }
 
 } // End namespace Foam
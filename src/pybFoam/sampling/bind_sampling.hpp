@@ -28,6 +28,8 @@ Description
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/vector.h>
 #include <nanobind/stl/shared_ptr.h>
+#include <nanobind/stl/optional.h>
+#include <nanobind/stl/pair.h>
 
 // OpenFOAM includes
 #include "sampledSurface.H"
@@ -45,10 +47,12 @@ namespace nb = nanobind;
 namespace Foam
 {
     void bindSampledSurface(nb::module_& m);
+    void bindSurfaceGeometry(nb::module_& m);
     void bindSampledSet(nb::module_& m);
     void bindMeshSearch(nb::module_& m);
     void bindInterpolation(nb::module_& m);
     void bindSamplingFunctions(nb::module_& m);
+    void bindProbes(nb::module_& m);
 }
 
 #endif
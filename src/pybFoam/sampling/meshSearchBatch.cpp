@@ -0,0 +1,219 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "meshSearchBatch.hpp"
+#include "boundBox.H"
+#include "parallelFor.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace
+{
+
+using namespace Foam;
+
+// Spread the lower 21 bits of x so that there are two zero bits between
+// consecutive bits
+uint64_t spreadBits(uint64_t x)
+{
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffffULL;
+    x = (x | x << 16) & 0x1f0000ff0000ffULL;
+    x = (x | x << 8) & 0x100f00f00f00f00fULL;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+    x = (x | x << 2) & 0x1249249249249249ULL;
+    return x;
+}
+
+
+// Point indices sorted along the Z-order curve of their bounding box
+std::vector<label> mortonOrder(const UList<point>& points)
+{
+    std::vector<label> order(points.size());
+    std::iota(order.begin(), order.end(), label(0));
+    if (points.size() < 2)
+    {
+        return order;
+    }
+
+    const boundBox bb(points, false);
+    const vector span = bb.span();
+    const scalar maxCode = 0x1fffff;
+
+    std::vector<uint64_t> codes(points.size());
+    parallel::parallelFor
+    (
+        points.size(),
+        [&](const label start, const label end)
+        {
+            for (label i = start; i < end; ++i)
+            {
+                uint64_t code = 0;
+                for (direction d = 0; d < vector::nComponents; ++d)
+                {
+                    const scalar t =
+                        span[d] > VSMALL
+                      ? (points[i][d] - bb.min()[d])/span[d]
+                      : 0;
+                    code |= spreadBits(uint64_t(t*maxCode)) << d;
+                }
+                codes[i] = code;
+            }
+        }
+    );
+
+    std::sort
+    (
+        order.begin(),
+        order.end(),
+        [&](const label a, const label b) { return codes[a] < codes[b]; }
+    );
+    return order;
+}
+
+
+// Build the demand-driven data used by the searches, which must not be
+// created concurrently
+void prepareSearch(const meshSearch& search)
+{
+    const polyMesh& mesh = search.mesh();
+    mesh.cells();
+    mesh.cellCentres();
+    mesh.faceCentres();
+    mesh.faceAreas();
+    mesh.tetBasePtIs();
+    search.cellTree();
+}
+
+} // End anonymous namespace
+
+
+// * * * * * * * * * * * * * * * Global Functions  * * * * * * * * * * * * * //
+
+void Foam::checkSeeds(const meshSearch& search, const labelUList& seeds)
+{
+    const label nCells = search.mesh().nCells();
+    forAll(seeds, i)
+    {
+        if (seeds[i] < -1 || seeds[i] >= nCells)
+        {
+            throw std::runtime_error
+            (
+                "seed " + std::to_string(seeds[i]) + " of point "
+              + std::to_string(i) + " is not a cell of the mesh"
+            );
+        }
+    }
+}
+
+
+Foam::labelList Foam::findCells
+(
+    const meshSearch& search,
+    const UList<point>& points,
+    const labelUList& seeds,
+    const bool useTreeSearch
+)
+{
+    prepareSearch(search);
+
+    const std::vector<label> order = mortonOrder(points);
+    labelList cells(points.size(), -1);
+
+    parallel::parallelFor
+    (
+        points.size(),
+        [&](const label start, const label end)
+        {
+            label prevCelli = -1;
+            for (label i = start; i < end; ++i)
+            {
+                const label pointi = order[i];
+                const point& pt = points[pointi];
+
+                label seedi = seeds.size() ? seeds[pointi] : -1;
+                if (seedi < 0)
+                {
+                    seedi = prevCelli;
+                }
+
+                label celli = -1;
+                if (seedi >= 0)
+                {
+                    celli = search.findCell(pt, seedi, useTreeSearch);
+                }
+                if (celli < 0)
+                {
+                    celli = search.findCell(pt, -1, useTreeSearch);
+                }
+
+                cells[pointi] = celli;
+                if (celli >= 0)
+                {
+                    prevCelli = celli;
+                }
+            }
+        }
+    );
+
+    return cells;
+}
+
+
+Foam::labelList Foam::findNearestCells
+(
+    const meshSearch& search,
+    const UList<point>& points
+)
+{
+    prepareSearch(search);
+    if (points.size())
+    {
+        // Builds the tree used by the nearest search
+        search.findNearestCell(points[0], -1, true);
+    }
+
+    const std::vector<label> order = mortonOrder(points);
+    labelList cells(points.size(), -1);
+
+    parallel::parallelFor
+    (
+        points.size(),
+        [&](const label start, const label end)
+        {
+            for (label i = start; i < end; ++i)
+            {
+                const label pointi = order[i];
+                cells[pointi] = search.findNearestCell(points[pointi], -1, true);
+            }
+        }
+    );
+
+    return cells;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,70 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Description
+    Cell search for many points at once.
+
+    The points are visited in Morton (Z-curve) order so that consecutive
+    points are close to each other. findCells walks from the cell found for
+    the previous point (or from the given seed) and falls back to the tree
+    search when the walk fails, e.g. across a concave boundary.
+    findNearestCells always uses the tree since the walk over cell centres
+    can end in a local minimum. The sorted points are split into chunks
+    that are searched in parallel.
+
+    The demand-driven mesh data and the search tree are built before the
+    parallel part, so the threads only read shared data.
+
+SourceFiles
+    meshSearchBatch.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_meshSearchBatch
+#define foam_meshSearchBatch
+
+#include "meshSearch.H"
+#include "labelList.H"
+#include "pointField.H"
+
+namespace Foam
+{
+
+//- Throw std::runtime_error unless every seed is -1 or a cell of the mesh
+void checkSeeds(const meshSearch& search, const labelUList& seeds);
+
+//- Cell containing each point, -1 if outside the mesh. seeds (may be
+//  empty) gives a start cell per point, -1 for none; they must have passed
+//  checkSeeds.
+labelList findCells
+(
+    const meshSearch& search,
+    const UList<point>& points,
+    const labelUList& seeds,
+    const bool useTreeSearch = true
+);
+
+//- Cell with the centre nearest to each point
+labelList findNearestCells
+(
+    const meshSearch& search,
+    const UList<point>& points
+);
+
+} // End namespace Foam
+
+#endif
@@ -0,0 +1,416 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "probeStream.hpp"
+#include "meshSearch.H"
+#include "meshSearchBatch.hpp"
+#include "volPointInterpolation.H"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace
+{
+
+template<class Type>
+void copyRow(double* row, const Foam::tmp<Foam::Field<Type>>& tvalues)
+{
+    const Foam::Field<Type>& values = tvalues();
+    std::memcpy(row, values.cdata(), values.size()*sizeof(Type));
+}
+
+} // End anonymous namespace
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::probeStream::probeStream
+(
+    const fvMesh& mesh,
+    const UList<point>& points,
+    const word& scheme,
+    const label capacity
+)
+:
+    points_(points),
+    cells_(),
+    weights_(),
+    scheme_(scheme),
+    columns_(),
+    capacity_(capacity),
+    times_(),
+    nRecorded_(0),
+    nWritten_(0),
+    takenStart_(0),
+    takenEnd_(0),
+    writer_(*this, "Probes")
+{
+    if (capacity_ < 1)
+    {
+        throw std::runtime_error("Probes capacity must be at least 1");
+    }
+
+    {
+        meshSearch search(mesh);
+        cells_ = findCells(search, points_, labelList(), true);
+    }
+
+    weights_.reset
+    (
+        new sampleSetWeights(mesh, points_, cells_, labelList(nProbes(), -1))
+    );
+
+    times_.assign(size_t(capacity_), 0.0);
+}
+
+
+// * * * * * * * * * * * * * Private Member Functions  * * * * * * * * * * * //
+
+template<class Type>
+void Foam::probeStream::addColumn
+(
+    const word& name,
+    const GeometricField<Type, fvPatchField, volMesh>& field
+)
+{
+    if (nRecorded_ > 0 || writer_.isOpen())
+    {
+        throw std::runtime_error
+        (
+            "Probes: fields must be added before open() and record()"
+        );
+    }
+
+    for (const column& col : columns_)
+    {
+        if (col.name == name)
+        {
+            throw std::runtime_error
+            (
+                "Probes: field '" + name + "' added twice"
+            );
+        }
+    }
+
+    if (&static_cast<const polyMesh&>(field.mesh()) != &weights_->mesh())
+    {
+        throw std::runtime_error
+        (
+            "Probes: field '" + name + "' is on a different mesh"
+        );
+    }
+
+    column col;
+    col.name = name;
+    col.nComponents = pTraits<Type>::nComponents;
+    col.buffer.assign(size_t(capacity_)*nProbes()*col.nComponents, 0.0);
+
+    const sampleSetWeights& weights = *weights_;
+
+    if (scheme_ == interpolationCellPoint<Type>::typeName)
+    {
+        // The point values are interpolated into the same field on every
+        // record instead of selecting a new interpolation
+        const volPointInterpolation& pointInterp =
+            volPointInterpolation::New(field.mesh());
+
+        auto psip =
+            std::make_shared<GeometricField<Type, pointPatchField, pointMesh>>
+            (
+                IOobject
+                (
+                    "volPointInterpolate(" + field.name() + ')',
+                    field.instance(),
+                    field.db(),
+                    IOobject::NO_READ,
+                    IOobject::NO_WRITE,
+                    IOobject::NO_REGISTER
+                ),
+                pointMesh::New(field.mesh()),
+                dimensioned<Type>(field.dimensions(), Zero)
+            );
+
+        col.sample = [&field, &weights, &pointInterp, psip](double* row)
+        {
+            pointInterp.interpolate(field, *psip);
+            copyRow(row, weights.sampleCellPoint(field, *psip));
+        };
+    }
+    else
+    {
+        std::shared_ptr<interpolation<Type>> interp
+        (
+            interpolation<Type>::New(scheme_, field).ptr()
+        );
+
+        if (interp->type() == interpolationCell<Type>::typeName)
+        {
+            // Refers to the field values, built once
+            col.sample = [&weights, interp](double* row)
+            {
+                copyRow(row, weights.sample(*interp));
+            };
+        }
+        else
+        {
+            // Other schemes may keep values derived from the field on
+            // construction (e.g. point values), select them on every record
+            const word scheme = scheme_;
+            col.sample = [&field, &weights, scheme](double* row)
+            {
+                copyRow
+                (
+                    row,
+                    weights.sample(*interpolation<Type>::New(scheme, field))
+                );
+            };
+        }
+    }
+
+    columns_.push_back(std::move(col));
+}
+
+
+void Foam::probeStream::writeHeader(std::ostream& os) const
+{
+    os.write("PYBFPRB1", 8);
+
+    writeInt64(os, nProbes());
+    for (const point& p : points_)
+    {
+        writeDoubles(os, p.cdata(), 3);
+    }
+
+    writeInt64(os, int64_t(columns_.size()));
+    for (const column& col : columns_)
+    {
+        writeInt64(os, int64_t(col.name.size()));
+        os.write(col.name.data(), std::streamsize(col.name.size()));
+        writeInt64(os, col.nComponents);
+    }
+}
+
+
+void Foam::probeStream::writeRows
+(
+    std::ostream& os,
+    int64_t start,
+    const int64_t end
+) const
+{
+    while (start < end)
+    {
+        const int64_t row = start % capacity_;
+        const int64_t nRows = std::min(end - start, int64_t(capacity_) - row);
+
+        writeInt64(os, nRows);
+        writeDoubles(os, times_.data() + row, size_t(nRows));
+
+        for (const column& col : columns_)
+        {
+            const size_t rowSize = size_t(nProbes())*col.nComponents;
+            writeDoubles
+            (
+                os,
+                col.buffer.data() + row*rowSize,
+                nRows*rowSize
+            );
+        }
+
+        start += nRows;
+    }
+}
+
+
+bool Foam::probeStream::blockReady() const
+{
+    return nRecorded_ - nWritten_ >= std::max<int64_t>(capacity_/2, 1);
+}
+
+
+void Foam::probeStream::takeBlock()
+{
+    takenStart_ = nWritten_;
+    takenEnd_ = nRecorded_;
+}
+
+
+void Foam::probeStream::writeBlock(std::ostream& os)
+{
+    // The taken rows are not touched by record() until nWritten_ moves
+    // past them
+    writeRows(os, takenStart_, takenEnd_);
+}
+
+
+void Foam::probeStream::blockWritten()
+{
+    nWritten_ = takenEnd_;
+}
+
+
+bool Foam::probeStream::pending() const
+{
+    return nWritten_ != nRecorded_;
+}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+void Foam::probeStream::add(const word& name, const volScalarField& field)
+{
+    addColumn(name, field);
+}
+
+
+void Foam::probeStream::add(const word& name, const volVectorField& field)
+{
+    addColumn(name, field);
+}
+
+
+void Foam::probeStream::add(const word& name, const volSymmTensorField& field)
+{
+    addColumn(name, field);
+}
+
+
+void Foam::probeStream::add(const word& name, const volTensorField& field)
+{
+    addColumn(name, field);
+}
+
+
+void Foam::probeStream::open(const std::string& path)
+{
+    if (!writer_.isOpen())
+    {
+        // The rows still in the buffer go to the file first
+        std::lock_guard<std::mutex> lock(writer_.mutex());
+        nWritten_ = nRecorded_ - nBuffered();
+    }
+
+    writer_.open(path, [this](std::ostream& os){ writeHeader(os); });
+}
+
+
+void Foam::probeStream::record(const scalar time)
+{
+    if (writer_.isOpen())
+    {
+        // Wait for the writer if the oldest row is not written yet
+        std::unique_lock<std::mutex> lock(writer_.mutex());
+        writer_.wait
+        (
+            lock,
+            [&]{ return nRecorded_ - nWritten_ < capacity_; }
+        );
+    }
+
+    // Only this thread changes nRecorded_
+    const int64_t row = nRecorded_ % capacity_;
+
+    times_[row] = time;
+    for (column& col : columns_)
+    {
+        col.sample
+        (
+            col.buffer.data() + row*size_t(nProbes())*col.nComponents
+        );
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(writer_.mutex());
+        ++nRecorded_;
+    }
+    writer_.notify();
+}
+
+
+void Foam::probeStream::flush()
+{
+    writer_.flush();
+}
+
+
+void Foam::probeStream::close()
+{
+    writer_.close();
+}
+
+
+Foam::label Foam::probeStream::nBuffered() const
+{
+    return label(std::min<int64_t>(nRecorded_, capacity_));
+}
+
+
+std::vector<double> Foam::probeStream::bufferedTimes() const
+{
+    const int64_t nRows = nBuffered();
+
+    std::vector<double> times(size_t(nRows));
+    for (int64_t i = 0; i < nRows; ++i)
+    {
+        times[i] = times_[(nRecorded_ - nRows + i) % capacity_];
+    }
+    return times;
+}
+
+
+std::vector<double> Foam::probeStream::bufferedValues
+(
+    const std::string& name,
+    label& nComponents
+) const
+{
+    for (const column& col : columns_)
+    {
+        if (col.name != name)
+        {
+            continue;
+        }
+
+        nComponents = col.nComponents;
+
+        const int64_t nRows = nBuffered();
+        const size_t rowSize = size_t(nProbes())*col.nComponents;
+
+        std::vector<double> values(nRows*rowSize);
+        for (int64_t i = 0; i < nRows; ++i)
+        {
+            const int64_t row = (nRecorded_ - nRows + i) % capacity_;
+            std::copy_n
+            (
+                col.buffer.data() + row*rowSize,
+                rowSize,
+                values.data() + i*rowSize
+            );
+        }
+        return values;
+    }
+
+    throw std::runtime_error("Probes: no field '" + name + "'");
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,204 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::probeStream
+
+Description
+    Probe values of several fields recorded into a ring buffer and streamed
+    to a binary file by a background thread (asyncBinaryWriter).
+
+    The probe cells and interpolation weights are computed once
+    (sampleSetWeights), and so are the cell and cellPoint interpolations
+    of every field; cellPoint keeps its point values and refreshes them in
+    place on each record. record() samples every field into the next row of
+    a preallocated buffer of capacity rows. Without a file the buffer keeps
+    the latest capacity rows; with a file (open) the writer thread appends
+    rows once half the buffer is filled, and record() only waits for it
+    when the whole buffer is pending.
+
+    File layout (native byte order), read by pybFoam.sampling.read_probes:
+
+        "PYBFPRB1"
+        int64 nProbes, float64 points[nProbes][3]
+        int64 nColumns, per column: int64 nameSize, name, int64 nComponents
+        blocks: int64 nRows, float64 time[nRows],
+                per column float64 values[nRows][nProbes][nComponents]
+
+SourceFiles
+    probeStream.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_probeStream
+#define foam_probeStream
+
+#include "sampleSetWeights.hpp"
+#include "asyncBinaryWriter.hpp"
+#include "volFields.H"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace Foam
+{
+
+class probeStream
+:
+    public asyncBinaryWriter::source
+{
+    // Private Data
+
+        //- Probe locations and their interpolation weights
+        pointField points_;
+        labelList cells_;
+        std::unique_ptr<sampleSetWeights> weights_;
+
+        //- Interpolation scheme of all fields
+        word scheme_;
+
+        struct column
+        {
+            std::string name;
+            label nComponents;
+
+            //- Sample the field into one buffer row
+            std::function<void(double*)> sample;
+
+            //- capacity rows of nProbes*nComponents values
+            std::vector<double> buffer;
+        };
+
+        std::vector<column> columns_;
+
+        label capacity_;
+        std::vector<double> times_;
+
+        //- Rows recorded and rows written to the file so far, guarded by
+        //  the mutex of the writer
+        int64_t nRecorded_;
+        int64_t nWritten_;
+
+        //- Rows [takenStart_, takenEnd_) taken by the writer thread
+        int64_t takenStart_;
+        int64_t takenEnd_;
+
+        asyncBinaryWriter writer_;
+
+
+    // Private Member Functions
+
+        template<class Type>
+        void addColumn
+        (
+            const word& name,
+            const GeometricField<Type, fvPatchField, volMesh>& field
+        );
+
+        void writeHeader(std::ostream& os) const;
+
+        //- Write rows [start, end) as one block per contiguous buffer range
+        void writeRows(std::ostream& os, int64_t start, int64_t end) const;
+
+        // asyncBinaryWriter::source
+
+            bool blockReady() const override;
+            void takeBlock() override;
+            void writeBlock(std::ostream& os) override;
+            void blockWritten() override;
+            bool pending() const override;
+
+
+public:
+
+    // Constructors
+
+        probeStream
+        (
+            const fvMesh& mesh,
+            const UList<point>& points,
+            const word& scheme,
+            const label capacity
+        );
+
+        probeStream(const probeStream&) = delete;
+        void operator=(const probeStream&) = delete;
+
+
+    // Member Functions
+
+        label nProbes() const noexcept
+        {
+            return points_.size();
+        }
+
+        const labelList& cells() const noexcept
+        {
+            return cells_;
+        }
+
+        label capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        int64_t nRecorded() const noexcept
+        {
+            return nRecorded_;
+        }
+
+        //- Add a field, before recording starts
+        void add(const word& name, const volScalarField& field);
+        void add(const word& name, const volVectorField& field);
+        void add(const word& name, const volSymmTensorField& field);
+        void add(const word& name, const volTensorField& field);
+
+        //- Stream the rows to path (truncated), starting with the rows
+        //  still in the buffer
+        void open(const std::string& path);
+
+        //- Sample all fields into the next row
+        void record(const scalar time);
+
+        //- Wait until all recorded rows are written
+        void flush();
+
+        //- Flush and close the file
+        void close();
+
+        //- Number of rows still in the buffer, at most capacity
+        label nBuffered() const;
+
+        //- Times of the buffered rows, oldest first
+        std::vector<double> bufferedTimes() const;
+
+        //- Values of the buffered rows of a column, oldest first, and its
+        //  number of components
+        std::vector<double> bufferedValues
+        (
+            const std::string& name,
+            label& nComponents
+        ) const;
+};
+
+} // End namespace Foam
+
+#endif
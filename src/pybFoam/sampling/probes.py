@@ -0,0 +1,80 @@
+"""Reader for the binary files written by ``Probes.open``."""
+
+from __future__ import annotations
+
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Dict, Union
+
+import numpy as np
+from numpy.typing import NDArray
+
+_MAGIC = b"PYBFPRB1"
+
+
+@dataclass
+class ProbeData:
+    """Probe time series: ``fields[name]`` has shape (nSteps, nProbes[, nComponents])."""
+
+    times: NDArray[np.float64]
+    points: NDArray[np.float64]
+    fields: Dict[str, NDArray[np.float64]] = field(default_factory=dict)
+
+
+def read_probes(path: Union[str, Path]) -> ProbeData:
+    """Read a probe file written by ``Probes.open``.
+
+    A file that is still being written is read up to its last complete block.
+    """
+    data = Path(path).read_bytes()
+    if data[: len(_MAGIC)] != _MAGIC:
+        raise ValueError(f"{path} is not a probe file")
+
+    pos = len(_MAGIC)
+
+    def read_int() -> int:
+        nonlocal pos
+        value = int(np.frombuffer(data, dtype=np.int64, count=1, offset=pos)[0])
+        pos += 8
+        return value
+
+    def read_doubles(n: int) -> NDArray[np.float64]:
+        nonlocal pos
+        values = np.frombuffer(data, dtype=np.float64, count=n, offset=pos)
+        pos += 8 * n
+        return values
+
+    n_probes = read_int()
+    points = read_doubles(3 * n_probes).reshape(n_probes, 3)
+
+    columns = []
+    for _ in range(read_int()):
+        size = read_int()
+        name = data[pos : pos + size].decode()
+        pos += size
+        columns.append((name, read_int()))
+
+    row_size = sum(n_probes * n_cmpt for _, n_cmpt in columns)
+    times = []
+    blocks: Dict[str, list[NDArray[np.float64]]] = {name: [] for name, _ in columns}
+    while pos + 8 <= len(data):
+        n_rows = int(np.frombuffer(data, dtype=np.int64, count=1, offset=pos)[0])
+        if pos + 8 + 8 * n_rows * (1 + row_size) > len(data):
+            break  # incomplete block
+        pos += 8
+        times.append(read_doubles(n_rows))
+        for name, n_cmpt in columns:
+            values = read_doubles(n_rows * n_probes * n_cmpt)
+            shape = (n_rows, n_probes) if n_cmpt == 1 else (n_rows, n_probes, n_cmpt)
+            blocks[name].append(values.reshape(shape))
+
+    fields = {}
+    for name, n_cmpt in columns:
+        empty_shape = (0, n_probes) if n_cmpt == 1 else (0, n_probes, n_cmpt)
+        fields[name] = np.concatenate(blocks[name]) if blocks[name] else np.empty(empty_shape)
+
+    return ProbeData(
+        times=np.concatenate(times) if times else np.empty(0),
+        points=points.copy(),
+        fields=fields,
+    )
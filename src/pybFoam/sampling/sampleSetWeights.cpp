@@ -0,0 +1,61 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "sampleSetWeights.hpp"
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::sampleSetWeights::sampleSetWeights
+(
+    const polyMesh& mesh,
+    const UList<point>& points,
+    const labelUList& cells,
+    const labelUList& faces
+)
+:
+    mesh_(mesh),
+    points_(points),
+    cells_(cells),
+    faces_(faces),
+    weightIndex_(points.size(), -1),
+    weights_()
+{
+    // Serial: the tet search triggers demand-driven mesh data
+    weights_.reserve(points_.size());
+    forAll(points_, samplei)
+    {
+        if (cells_[samplei] >= 0)
+        {
+            weightIndex_[samplei] = label(weights_.size());
+            weights_.emplace_back
+            (
+                mesh_, points_[samplei], cells_[samplei], faces_[samplei]
+            );
+        }
+    }
+}
+
+
+Foam::sampleSetWeights::sampleSetWeights(const sampledSet& set)
+:
+    sampleSetWeights(set.mesh(), set.points(), set.cells(), set.faces())
+{}
+
+
+// ************************************************************************* //
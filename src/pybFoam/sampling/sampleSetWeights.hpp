@@ -0,0 +1,235 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::sampleSetWeights
+
+Description
+    Interpolation weights of the points of a sampledSet (or any located
+    points), computed once.
+
+    interpolationCellPoint locates the tetrahedron containing every sample
+    (cellPointWeight) on each call; here this is done on construction and
+    sampling a field is a gather-multiply-add over the cached weights,
+    split over the thread pool. The cell scheme needs no weights and is a
+    plain gather. Other schemes are evaluated through the virtual
+    interpolate() serially, as before.
+
+    The weights refer to the mesh geometry at construction, so they have to
+    be recomputed when the mesh moves.
+
+SourceFiles
+    sampleSetWeights.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_sampleSetWeights
+#define foam_sampleSetWeights
+
+#include "sampledSet.H"
+#include "cellPointWeight.H"
+#include "interpolation.H"
+#include "interpolationCell.H"
+#include "interpolationCellPoint.H"
+#include "pointFields.H"
+#include "parallelFor.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+namespace Foam
+{
+
+class sampleSetWeights
+{
+    // Private Data
+
+        const polyMesh& mesh_;
+
+        //- Sample points
+        pointField points_;
+
+        //- Cell and face of every sample, -1 if not found
+        labelList cells_;
+        labelList faces_;
+
+        //- Tet weights of the samples with a cell (index into weights_),
+        //  -1 for the others
+        labelList weightIndex_;
+
+        std::vector<cellPointWeight> weights_;
+
+
+public:
+
+    // Constructors
+
+        explicit sampleSetWeights(const sampledSet& set);
+
+        //- From points with their cells and faces (-1 if not found)
+        sampleSetWeights
+        (
+            const polyMesh& mesh,
+            const UList<point>& points,
+            const labelUList& cells,
+            const labelUList& faces
+        );
+
+
+    // Member Functions
+
+        const polyMesh& mesh() const noexcept
+        {
+            return mesh_;
+        }
+
+        label size() const noexcept
+        {
+            return points_.size();
+        }
+
+        //- Field values at the samples, pTraits<Type>::max outside the mesh
+        template<class Type>
+        tmp<Field<Type>> sample(const interpolation<Type>& interp) const
+        {
+            if (&static_cast<const polyMesh&>(interp.psi().mesh()) != &mesh_)
+            {
+                throw std::runtime_error
+                (
+                    "interpolator and sampledSet are on different meshes"
+                );
+            }
+
+            auto tvalues = tmp<Field<Type>>::New(size(), pTraits<Type>::max);
+            Field<Type>& values = tvalues.ref();
+
+            // Exact types: derived schemes (e.g. cellPointWallModified)
+            // interpolate differently and take the generic path
+            if (interp.type() == interpolationCellPoint<Type>::typeName)
+            {
+                const auto* cellPoint =
+                    static_cast<const interpolationCellPoint<Type>*>(&interp);
+
+                parallel::parallelFor
+                (
+                    size(),
+                    [&](const label start, const label end)
+                    {
+                        for (label samplei = start; samplei < end; ++samplei)
+                        {
+                            const label weighti = weightIndex_[samplei];
+                            if (weighti >= 0)
+                            {
+                                values[samplei] =
+                                    cellPoint->interpolate(weights_[weighti]);
+                            }
+                        }
+                    }
+                );
+            }
+            else if (interp.type() == interpolationCell<Type>::typeName)
+            {
+                const Field<Type>& psi = interp.psi().primitiveField();
+                parallel::parallelFor
+                (
+                    size(),
+                    [&](const label start, const label end)
+                    {
+                        for (label samplei = start; samplei < end; ++samplei)
+                        {
+                            if (cells_[samplei] >= 0)
+                            {
+                                values[samplei] = psi[cells_[samplei]];
+                            }
+                        }
+                    }
+                );
+            }
+            else
+            {
+                forAll(points_, samplei)
+                {
+                    if (cells_[samplei] >= 0 || faces_[samplei] >= 0)
+                    {
+                        values[samplei] = interp.interpolate
+                        (
+                            points_[samplei], cells_[samplei], faces_[samplei]
+                        );
+                    }
+                }
+            }
+
+            return tvalues;
+        }
+
+        //- Field values at the samples as the cellPoint scheme, from the
+        //  cell values psi and the point values psip kept by the caller
+        template<class Type>
+        tmp<Field<Type>> sampleCellPoint
+        (
+            const GeometricField<Type, fvPatchField, volMesh>& psi,
+            const GeometricField<Type, pointPatchField, pointMesh>& psip
+        ) const
+        {
+            if (&static_cast<const polyMesh&>(psi.mesh()) != &mesh_)
+            {
+                throw std::runtime_error
+                (
+                    "field and sampledSet are on different meshes"
+                );
+            }
+
+            auto tvalues = tmp<Field<Type>>::New(size(), pTraits<Type>::max);
+            Field<Type>& values = tvalues.ref();
+
+            const Field<Type>& cellValues = psi.primitiveField();
+            const Field<Type>& pointValues = psip.primitiveField();
+
+            parallel::parallelFor
+            (
+                size(),
+                [&](const label start, const label end)
+                {
+                    for (label samplei = start; samplei < end; ++samplei)
+                    {
+                        const label weighti = weightIndex_[samplei];
+                        if (weighti < 0)
+                        {
+                            continue;
+                        }
+
+                        // As interpolationCellPoint::interpolate(cpw)
+                        const cellPointWeight& cpw = weights_[weighti];
+                        const barycentric& w = cpw.weights();
+                        const triFace& tri = cpw.faceVertices();
+
+                        Type t = cellValues[cpw.cell()]*w[0];
+                        t += pointValues[tri[0]]*w[1];
+                        t += pointValues[tri[1]]*w[2];
+                        t += pointValues[tri[2]]*w[3];
+                        values[samplei] = t;
+                    }
+                }
+            );
+
+            return tvalues;
+        }
+};
+
+} // End namespace Foam
+
+#endif
@@ -21,6 +21,7 @@ Description
 \*---------------------------------------------------------------------------*/
 
 #include "bind_sampling.hpp"
+#include "parallelFor.hpp"
 
 namespace nb = nanobind;
 
@@ -28,8 +29,15 @@ NB_MODULE(sampling_bindings, m) {
     m.doc() = "OpenFOAM sampling and surface functionality";
 
     Foam::bindSampledSurface(m);
+    Foam::bindSurfaceGeometry(m);
     Foam::bindMeshSearch(m);
     Foam::bindSampledSet(m);
     Foam::bindInterpolation(m);
     Foam::bindSamplingFunctions(m);
+    Foam::bindProbes(m);
+
+    m.def("set_num_threads", &Foam::parallel::setNumThreads, nb::arg("n"),
+        "Set the number of threads of the sampling kernels in this module (n < 1: all cores)");
+    m.def("get_num_threads", &Foam::parallel::numThreads,
+        "Number of threads of the sampling kernels in this module");
 }
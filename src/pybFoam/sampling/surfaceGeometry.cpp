@@ -0,0 +1,115 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+\*---------------------------------------------------------------------------*/
+
+#include "surfaceGeometry.hpp"
+
+#include <utility>
+
+// * * * * * * * * * * * * * * * Local Functions * * * * * * * * * * * * * * //
+
+namespace Foam
+{
+    //- Flatten the faces into offsets and point labels
+    static void flattenFaces
+    (
+        const faceList& faces,
+        labelList& offsets,
+        labelList& values
+    )
+    {
+        offsets.resize(faces.size() + 1);
+        label n = 0;
+        forAll(faces, facei)
+        {
+            offsets[facei] = n;
+            n += faces[facei].size();
+        }
+        offsets[faces.size()] = n;
+
+        values.resize(n);
+        forAll(faces, facei)
+        {
+            const face& f = faces[facei];
+            label* dest = values.data() + offsets[facei];
+            forAll(f, fp)
+            {
+                dest[fp] = f[fp];
+            }
+        }
+    }
+}
+
+
+// * * * * * * * * * * * * * * * * Constructors  * * * * * * * * * * * * * * //
+
+Foam::surfaceGeometry::surfaceGeometry(sampledSurface& surface)
+:
+    surface_(surface),
+    faceOffsets_(std::make_shared<const labelList>()),
+    facePoints_(std::make_shared<const labelList>()),
+    points_(),
+    version_(0)
+{}
+
+
+// * * * * * * * * * * * * * * * Member Functions  * * * * * * * * * * * * * //
+
+bool Foam::surfaceGeometry::update()
+{
+    surface_.update();
+
+    if (version_ > 0 && surface_.invariant())
+    {
+        return false;
+    }
+
+    labelList offsets;
+    labelList values;
+    flattenFaces(surface_.faces(), offsets, values);
+
+    if
+    (
+        version_ > 0
+     && offsets == *faceOffsets_
+     && values == *facePoints_
+     && surface_.points() == points_
+    )
+    {
+        return false;
+    }
+
+    // New lists: views of the previous ones keep them alive
+    faceOffsets_ = std::make_shared<const labelList>(std::move(offsets));
+    facePoints_ = std::make_shared<const labelList>(std::move(values));
+
+    if (surface_.invariant())
+    {
+        points_.clear();
+    }
+    else
+    {
+        points_ = surface_.points();
+    }
+
+    ++version_;
+    return true;
+}
+
+
+// ************************************************************************* //
@@ -0,0 +1,107 @@
+/*---------------------------------------------------------------------------*\
+            Copyright (c) 2026, Henning Scheufler
+-------------------------------------------------------------------------------
+License
+    This file is part of the pybFoam source code library, which is an
+	unofficial extension to OpenFOAM.
+    OpenFOAM is free software: you can redistribute it and/or modify it
+    under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+    OpenFOAM is distributed in the hope that it will be useful, but WITHOUT
+    ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+    FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+    for more details.
+    You should have received a copy of the GNU General Public License
+    along with OpenFOAM.  If not, see <http://www.gnu.org/licenses/>.
+
+Class
+    Foam::surfaceGeometry
+
+Description
+    Face connectivity of a sampledSurface in compressed sparse row form,
+    kept across updates of the surface.
+
+    update() updates the surface and reports whether its geometry changed.
+    An invariant surface is flattened once and never checked again. For
+    the others the new faces and points are compared with the previous
+    ones, so a writer only has to send the geometry when update() returns
+    true.
+
+    The CSR lists are held by shared_ptr and replaced, not modified, on a
+    geometry change, so lists handed out before an update stay valid.
+
+SourceFiles
+    surfaceGeometry.cpp
+
+\*---------------------------------------------------------------------------*/
+
+#ifndef foam_surfaceGeometry
+#define foam_surfaceGeometry
+
+#include "sampledSurface.H"
+#include "labelList.H"
+#include "pointField.H"
+
+#include <memory>
+
+namespace Foam
+{
+
+class surfaceGeometry
+{
+    // Private Data
+
+        sampledSurface& surface_;
+
+        //- Start of each face in facePoints_, nFaces + 1 entries
+        std::shared_ptr<const labelList> faceOffsets_;
+
+        //- Point labels of all faces
+        std::shared_ptr<const labelList> facePoints_;
+
+        //- Points of the last geometry, only kept for surfaces that are
+        //  not invariant
+        pointField points_;
+
+        //- Number of geometry changes, 0 before the first update
+        label version_;
+
+
+public:
+
+    // Constructors
+
+        explicit surfaceGeometry(sampledSurface& surface);
+
+
+    // Member Functions
+
+        const sampledSurface& surface() const noexcept
+        {
+            return surface_;
+        }
+
+        //- Update the surface, true if the geometry differs from the last
+        //  call (always on the first call)
+        bool update();
+
+        label version() const noexcept
+        {
+            return version_;
+        }
+
+        const std::shared_ptr<const labelList>& faceOffsets() const noexcept
+        {
+            return faceOffsets_;
+        }
+
+        const std::shared_ptr<const labelList>& facePoints() const noexcept
+        {
+            return facePoints_;
+        }
+};
+
+} // End namespace Foam
+
+#endif
@@ -0,0 +1,193 @@
+"""Stream sampled surface values to a binary file, sending the geometry only
+when it changes.
+
+File layout (native byte order)::
+
+    b"PYBFSRF1"
+    records, each starting with an int64 kind:
+      0 geometry: int64 nPoints, float64 points[nPoints][3],
+                  int64 nFaces, int64 offsets[nFaces + 1],
+                  int64 nLabels, int64 pointLabels[nLabels]
+      1 fields:   float64 time, int64 nFields, per field:
+                  int64 nameSize, name, int64 nValues, int64 nComponents,
+                  float64 values[nValues][nComponents]
+
+Field records belong to the last geometry record before them.
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass, field
+from pathlib import Path
+from types import TracebackType
+from typing import Any, BinaryIO, Dict, List, Mapping, Optional, Type, Union
+
+import numpy as np
+from numpy.typing import ArrayLike, NDArray
+
+from pybFoam.sampling_bindings import sampledSurface, surfaceGeometry
+
+_MAGIC = b"PYBFSRF1"
+_GEOMETRY = 0
+_FIELDS = 1
+
+
+def _write_int(f: BinaryIO, value: int) -> None:
+    f.write(np.int64(value).tobytes())
+
+
+class SurfaceStream:
+    """Write field values on a sampled surface, one record per ``write`` call.
+
+    Each step calls ``update()`` before sampling the fields, then
+    ``write()``. The points and faces are written by ``update()`` on the
+    first call and afterwards only when ``surfaceGeometry.update()`` reports
+    a change, so an invariant surface (e.g. a plane on a static mesh) sends
+    its topology once.
+    """
+
+    def __init__(self, path: Union[str, Path], surface: sampledSurface) -> None:
+        self.geometry = surfaceGeometry(surface)
+        self.n_geometries = 0
+        self._n_faces = 0
+        self._n_points = 0
+        self._file: Optional[BinaryIO] = open(path, "wb")
+        self._file.write(_MAGIC)
+
+    def _open_file(self) -> BinaryIO:
+        if self._file is None:
+            raise ValueError("SurfaceStream is closed")
+        return self._file
+
+    def update(self) -> bool:
+        """Update the surface and write its geometry if it changed.
+
+        Call before sampling the fields of a step. Returns True if the
+        geometry was written.
+        """
+        f = self._open_file()
+
+        changed = self.geometry.update()
+        if changed:
+            points = self.geometry.points()
+            offsets, labels = self.geometry.facesCSR()
+            _write_int(f, _GEOMETRY)
+            _write_int(f, len(points))
+            f.write(np.ascontiguousarray(points, dtype=np.float64).data)
+            _write_int(f, len(offsets) - 1)
+            f.write(np.asarray(offsets, dtype=np.int64).tobytes())
+            _write_int(f, len(labels))
+            f.write(np.asarray(labels, dtype=np.int64).tobytes())
+            self.n_geometries += 1
+            self._n_faces = len(offsets) - 1
+            self._n_points = len(points)
+
+        return changed
+
+    def write(self, time: float, fields: Mapping[str, ArrayLike]) -> None:
+        """Write the field values (one entry per face or point of the
+        geometry of the last ``update()``) at time.
+        """
+        f = self._open_file()
+        if self.n_geometries == 0:
+            raise ValueError("SurfaceStream.update() must be called before write()")
+
+        arrays = {
+            name: np.ascontiguousarray(values, dtype=np.float64) for name, values in fields.items()
+        }
+        for name, array in arrays.items():
+            if array.ndim == 0 or array.shape[0] not in (self._n_faces, self._n_points):
+                raise ValueError(
+                    f"{name}: {array.shape[0] if array.ndim else 1} values, the geometry has "
+                    f"{self._n_faces} faces and {self._n_points} points"
+                )
+
+        _write_int(f, _FIELDS)
+        f.write(np.float64(time).tobytes())
+        _write_int(f, len(arrays))
+        for name, array in arrays.items():
+            encoded = name.encode()
+            _write_int(f, len(encoded))
+            f.write(encoded)
+            _write_int(f, array.shape[0])
+            _write_int(f, 1 if array.ndim == 1 else int(np.prod(array.shape[1:])))
+            f.write(array.data)
+
+    def close(self) -> None:
+        if self._file is not None:
+            self._file.close()
+            self._file = None
+
+    def __enter__(self) -> SurfaceStream:
+        return self
+
+    def __exit__(
+        self,
+        exc_type: Optional[Type[BaseException]],
+        exc: Optional[BaseException],
+        tb: Optional[TracebackType],
+    ) -> None:
+        self.close()
+
+
+@dataclass
+class SurfaceGeometryData:
+    points: NDArray[np.float64]
+    offsets: NDArray[np.int64]
+    point_labels: NDArray[np.int64]
+
+
+@dataclass
+class SurfaceFrame:
+    time: float
+    geometry: int
+    """Index into ``SurfaceStreamData.geometries``"""
+    fields: Dict[str, NDArray[np.float64]] = field(default_factory=dict)
+
+
+@dataclass
+class SurfaceStreamData:
+    geometries: List[SurfaceGeometryData] = field(default_factory=list)
+    frames: List[SurfaceFrame] = field(default_factory=list)
+
+
+def read_surface_stream(path: Union[str, Path]) -> SurfaceStreamData:
+    """Read a file written by ``SurfaceStream``."""
+    data = Path(path).read_bytes()
+    if data[: len(_MAGIC)] != _MAGIC:
+        raise ValueError(f"{path} is not a surface stream file")
+
+    pos = len(_MAGIC)
+
+    def read(dtype: type, count: int) -> NDArray[Any]:
+        nonlocal pos
+        values: NDArray[Any] = np.frombuffer(data, dtype=dtype, count=count, offset=pos)
+        pos += values.nbytes
+        return values
+
+    def read_int() -> int:
+        return int(read(np.int64, 1)[0])
+
+    result = SurfaceStreamData()
+    while pos < len(data):
+        kind = read_int()
+        if kind == _GEOMETRY:
+            points = read(np.float64, 3 * read_int()).reshape(-1, 3)
+            offsets = read(np.int64, read_int() + 1)
+            labels = read(np.int64, read_int())
+            result.geometries.append(SurfaceGeometryData(points, offsets, labels))
+        elif kind == _FIELDS:
+            frame = SurfaceFrame(float(read(np.float64, 1)[0]), len(result.geometries) - 1)
+            for _ in range(read_int()):
+                size = read_int()
+                name = data[pos : pos + size].decode()
+                pos += size
+                n_values = read_int()
+                n_cmpt = read_int()
+                values = read(np.float64, n_values * n_cmpt)
+                frame.fields[name] = values if n_cmpt == 1 else values.reshape(n_values, n_cmpt)
+            result.frames.append(frame)
+        else:
+            raise ValueError(f"{path}: unknown record kind {kind}")
+
+    return result
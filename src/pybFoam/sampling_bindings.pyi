@@ -1,5 +1,11 @@
 """OpenFOAM sampling and surface functionality"""
 
+from collections.abc import Mapping
+from typing import Annotated, overload
+
+import numpy
+from numpy.typing import NDArray
+
 import pybFoam.pybFoam_core
 
 
@@ -43,10 +49,45 @@ class sampledSurface:
     def hasFaceIds(self) -> bool:
         """Check if element ids/order of original surface are available"""
 
+    def pointsArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Points (nPoints, 3), read-only view until the next update"""
+
+    def CfArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Face centres (nFaces, 3), read-only view until the next update"""
+
+    def SfArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Face area vectors (nFaces, 3), read-only view until the next update"""
+
+    def magSfArray(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Face areas, read-only view until the next update"""
+
     @staticmethod
     def New(name: pybFoam.pybFoam_core.Word, mesh: pybFoam.pybFoam_core.fvMesh, dict: pybFoam.pybFoam_core.dictionary) -> sampledSurface:
         """Construct a new sampledSurface from dictionary (fvMesh overload)"""
 
+class surfaceGeometry:
+    def __init__(self, surface: sampledSurface) -> None:
+        """Face connectivity of the surface, kept across updates"""
+
+    def update(self) -> bool:
+        """
+        Update the surface, True if its geometry changed since the last
+        call (always on the first call, never again for invariant surfaces)
+        """
+
+    def version(self) -> int:
+        """Number of geometry changes seen by update()"""
+
+    def points(self) -> Annotated[NDArray[numpy.float64], dict(writable=False)]:
+        """Surface points (nPoints, 3), read-only view until the next update"""
+
+    def facesCSR(self) -> tuple[Annotated[NDArray[numpy.int32], dict(writable=False)], Annotated[NDArray[numpy.int32], dict(writable=False)]]:
+        """
+        (offsets, pointLabels) of the faces, face i is
+        pointLabels[offsets[i]:offsets[i + 1]]. The arrays keep the faces of
+        this geometry version, later updates do not modify them
+        """
+
 class meshSearch:
     def __init__(self, mesh: pybFoam.pybFoam_core.fvMesh) -> None:
         """Construct from fvMesh"""
@@ -57,6 +98,16 @@ class meshSearch:
     def findCell(self, location: pybFoam.pybFoam_core.vector, seedCelli: int = -1, useTreeSearch: bool = True) -> int:
         """Find cell containing location"""
 
+    def findCells(self, points: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], seeds: Annotated[NDArray[numpy.int32], dict(order='C', device='cpu', writable=False)] | None = None, useTreeSearch: bool = True) -> NDArray[numpy.int32]:
+        """
+        Cells containing the (N, 3) points, -1 outside the mesh. Optional
+        seeds give a start cell per point (-1: none), other values must be
+        cells of the mesh
+        """
+
+    def findNearestCells(self, points: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)]) -> NDArray[numpy.int32]:
+        """Cells with the centre nearest to the (N, 3) points"""
+
 class sampledSet:
     def name(self) -> pybFoam.pybFoam_core.Word:
         """Get the name of the set"""
@@ -106,6 +157,79 @@ class interpolationSymmTensor:
     def New(interpolationType: pybFoam.pybFoam_core.Word, field: pybFoam.pybFoam_core.volSymmTensorField) -> interpolationSymmTensor:
         """Create symmTensor interpolation scheme"""
 
+class sampleSetWeights:
+    def __init__(self, sampledSet: sampledSet) -> None:
+        """Precompute the interpolation weights of the set points (static mesh)"""
+
+    def size(self) -> int:
+        """Number of sample points"""
+
+class Probes:
+    def __init__(self, mesh: pybFoam.pybFoam_core.fvMesh, points: Annotated[NDArray[numpy.float64], dict(order='C', device='cpu', writable=False)], scheme: str = 'cellPoint', capacity: int = 1024) -> None:
+        """
+        Probes at the (N, 3) points, located once. Up to capacity time
+        steps are kept in memory
+        """
+
+    def nProbes(self) -> int:
+        """Number of probes"""
+
+    def cells(self) -> Annotated[NDArray[numpy.int32], dict(writable=False)]:
+        """
+        Cell of every probe, -1 outside the mesh (values are then the
+        largest representable value)
+        """
+
+    def capacity(self) -> int:
+        """Number of time steps held in memory"""
+
+    def nRecorded(self) -> int:
+        """Number of time steps recorded so far"""
+
+    @overload
+    def add(self, name: str, field: pybFoam.pybFoam_core.volScalarField) -> None:
+        """Add a field to sample, before open() and record()"""
+
+    @overload
+    def add(self, name: str, field: pybFoam.pybFoam_core.volVectorField) -> None: ...
+
+    @overload
+    def add(self, name: str, field: pybFoam.pybFoam_core.volSymmTensorField) -> None: ...
+
+    @overload
+    def add(self, name: str, field: pybFoam.pybFoam_core.volTensorField) -> None: ...
+
+    def open(self, path: str) -> None:
+        """
+        Stream all time steps to a binary file (read with read_probes),
+        starting with the ones still in memory
+        """
+
+    def record(self, time: float) -> None:
+        """Sample all fields at this time step"""
+
+    def flush(self) -> None:
+        """Wait until all recorded time steps are written"""
+
+    def close(self) -> None:
+        """Write the pending time steps and close the file"""
+
+    def times(self) -> NDArray[numpy.float64]:
+        """Times of the time steps in memory, oldest first"""
+
+    def values(self, name: str) -> NDArray[numpy.float64]:
+        """
+        Values of a field at the time steps in memory, oldest first,
+        shape (nSteps, nProbes) or (nSteps, nProbes, nComponents)
+        """
+
+def sampleFields(surface: sampledSurface, interpolators: Mapping[str, interpolationScalar | interpolationVector | interpolationTensor | interpolationSymmTensor]) -> dict[str, NDArray[numpy.float64]]:
+    """
+    Sample several fields onto the surface faces in one pass.
+    interpolators maps names to interpolation objects, the result maps
+    the same names to NumPy arrays of the face values
+    """
+
 def sampleOnFacesScalar(surface: sampledSurface, interpolator: interpolationScalar) -> pybFoam.pybFoam_core.scalarField:
     """Sample scalar field values onto surface faces"""
 
@@ -130,14 +254,42 @@ def sampleOnPointsTensor(surface: sampledSurface, interpolator: interpolationTen
 def sampleOnPointsSymmTensor(surface: sampledSurface, interpolator: interpolationSymmTensor) -> pybFoam.pybFoam_core.symmTensorField:
     """Interpolate symmTensor field values onto surface points"""
 
+@overload
 def sampleSetScalar(sampledSet: sampledSet, interpolator: interpolationScalar) -> pybFoam.pybFoam_core.scalarField:
     """Sample scalar field values onto sampledSet points"""
 
+@overload
+def sampleSetScalar(weights: sampleSetWeights, interpolator: interpolationScalar) -> pybFoam.pybFoam_core.scalarField:
+    """Sample scalar field values using precomputed weights, threaded"""
+
+@overload
 def sampleSetVector(sampledSet: sampledSet, interpolator: interpolationVector) -> pybFoam.pybFoam_core.vectorField:
     """Sample vector field values onto sampledSet points"""
 
+@overload
+def sampleSetVector(weights: sampleSetWeights, interpolator: interpolationVector) -> pybFoam.pybFoam_core.vectorField:
+    """Sample vector field values using precomputed weights, threaded"""
+
+@overload
 def sampleSetTensor(sampledSet: sampledSet, interpolator: interpolationTensor) -> pybFoam.pybFoam_core.tensorField:
     """Sample tensor field values onto sampledSet points"""
 
+@overload
+def sampleSetTensor(weights: sampleSetWeights, interpolator: interpolationTensor) -> pybFoam.pybFoam_core.tensorField:
+    """Sample tensor field values using precomputed weights, threaded"""
+
+@overload
 def sampleSetSymmTensor(sampledSet: sampledSet, interpolator: interpolationSymmTensor) -> pybFoam.pybFoam_core.symmTensorField:
     """Sample symmTensor field values onto sampledSet points"""
+
+@overload
+def sampleSetSymmTensor(weights: sampleSetWeights, interpolator: interpolationSymmTensor) -> pybFoam.pybFoam_core.symmTensorField:
+    """Sample symmTensor field values using precomputed weights, threaded"""
+
+def set_num_threads(n: int) -> None:
+    """
+    Set the number of threads of the sampling kernels in this module (n < 1: all cores)
+    """
+
+def get_num_threads() -> int:
+    """Number of threads of the sampling kernels in this module"""
@@ -0,0 +1,182 @@
+"""Timing and convergence of the linear solves.
+
+Once enabled, every ``fvMatrix.solve``, ``solve`` and ``solve_all`` call
+records the field, solver, wall time, iterations and the largest component
+residuals into a C++ buffer, without parsing ``solverPerformanceDict``::
+
+    from pybFoam import telemetry
+
+    telemetry.enable()
+    telemetry.open("solves.bin")  # optional, written by a background thread
+    ...
+    records = telemetry.records()
+    slow = records.wall_time > 1.0
+    telemetry.close()
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Dict, List, Union
+
+import numpy as np
+from numpy.typing import NDArray
+
+from pybFoam.pybFoam_core import solveTelemetry
+
+_MAGIC = b"PYBFSLV1"
+_NAME = 0
+_RECORDS = 1
+
+# Layout of solveTelemetry::record
+_RECORD_DTYPE = np.dtype(
+    [
+        ("time", np.float64),
+        ("wall_time", np.float64),
+        ("initial_residual", np.float64),
+        ("final_residual", np.float64),
+        ("field", np.int32),
+        ("solver", np.int32),
+        ("iterations", np.int32),
+        ("converged", np.int32),
+    ]
+)
+
+
+@dataclass
+class SolveRecords:
+    """One entry per solve; ``field`` and ``solver`` index into ``names``."""
+
+    names: List[str]
+    time: NDArray[np.float64]
+    wall_time: NDArray[np.float64]
+    field: NDArray[np.int32]
+    solver: NDArray[np.int32]
+    iterations: NDArray[np.int32]
+    initial_residual: NDArray[np.float64]
+    final_residual: NDArray[np.float64]
+    converged: NDArray[np.bool_]
+
+    def __len__(self) -> int:
+        return len(self.time)
+
+    def field_names(self) -> List[str]:
+        return [self.names[i] for i in self.field]
+
+    def solver_names(self) -> List[str]:
+        return [self.names[i] for i in self.solver]
+
+    def select(self, field_name: str) -> NDArray[np.bool_]:
+        """Mask of the solves of one field."""
+        if field_name not in self.names:
+            return np.zeros(len(self), dtype=np.bool_)
+        return np.asarray(self.field == self.names.index(field_name))
+
+
+def enable(capacity: int = 65536) -> None:
+    """Start recording, keeping the latest ``capacity`` solves in memory."""
+    solveTelemetry.instance().enable(capacity)
+
+
+def disable() -> None:
+    solveTelemetry.instance().disable()
+
+
+def enabled() -> bool:
+    return solveTelemetry.instance().enabled()
+
+
+def clear() -> None:
+    """Forget the solves in memory."""
+    solveTelemetry.instance().clear()
+
+
+def open(path: Union[str, Path]) -> None:
+    """Stream all further solves to a binary file (read with ``read_solve_telemetry``)."""
+    solveTelemetry.instance().open(str(path))
+
+
+def flush() -> None:
+    solveTelemetry.instance().flush()
+
+
+def close() -> None:
+    solveTelemetry.instance().close()
+
+
+def records() -> SolveRecords:
+    """The solves in memory, oldest first."""
+    telemetry = solveTelemetry.instance()
+    columns = telemetry.arrays()
+    return SolveRecords(
+        names=list(telemetry.names()),
+        time=columns["time"],
+        wall_time=columns["wall_time"],
+        field=columns["field"],
+        solver=columns["solver"],
+        iterations=columns["iterations"],
+        initial_residual=columns["initial_residual"],
+        final_residual=columns["final_residual"],
+        converged=columns["converged"].astype(np.bool_),
+    )
+
+
+def read_solve_telemetry(path: Union[str, Path]) -> SolveRecords:
+    """Read a file written after ``open``; an incomplete last block is skipped."""
+    data = Path(path).read_bytes()
+    if data[: len(_MAGIC)] != _MAGIC:
+        raise ValueError(f"{path} is not a solve telemetry file")
+
+    pos = len(_MAGIC)
+
+    def read_int() -> int:
+        nonlocal pos
+        value = int(np.frombuffer(data, dtype=np.int64, count=1, offset=pos)[0])
+        pos += 8
+        return value
+
+    names: Dict[int, str] = {}
+    blocks = []
+    while pos + 16 <= len(data):
+        kind = read_int()
+        if kind == _NAME:
+            name_id = read_int()
+            size = read_int()
+            names[name_id] = data[pos : pos + size].decode()
+            pos += size
+        elif kind == _RECORDS:
+            n = read_int()
+            if pos + n * _RECORD_DTYPE.itemsize > len(data):
+                break
+            blocks.append(np.frombuffer(data, dtype=_RECORD_DTYPE, count=n, offset=pos))
+            pos += n * _RECORD_DTYPE.itemsize
+        else:
+            raise ValueError(f"{path}: unknown entry kind {kind}")
+
+    table = np.concatenate(blocks) if blocks else np.empty(0, dtype=_RECORD_DTYPE)
+    return SolveRecords(
+        names=[names[i] for i in range(len(names))],
+        time=table["time"].copy(),
+        wall_time=table["wall_time"].copy(),
+        field=table["field"].copy(),
+        solver=table["solver"].copy(),
+        iterations=table["iterations"].copy(),
+        initial_residual=table["initial_residual"].copy(),
+        final_residual=table["final_residual"].copy(),
+        converged=table["converged"].astype(np.bool_),
+    )
+
+
+__all__ = [
+    "SolveRecords",
+    "clear",
+    "close",
+    "disable",
+    "enable",
+    "enabled",
+    "flush",
+    "open",
+    "read_solve_telemetry",
+    "records",
+]
@@ -162,3 +162,21 @@ def test_blockmesh_comparison(
     assert native_stats["mesh_stats"]["internal_faces"] == 22800, (
         f"Expected 22800 internal faces, got {native_stats['mesh_stats']['internal_faces']}"
     )
+
+
+def test_blockmesh_in_memory(temp_case_python: Path) -> None:
+    """write=False builds the fvMesh without touching constant/polyMesh."""
+    argv = [str(temp_case_python), "-case", str(temp_case_python)]
+    time = core.Time(core.argList(argv))
+    block_mesh_dict = core.dictionary.read(str(temp_case_python / "system" / "blockMeshDict"))
+
+    mesh = meshing.generate_blockmesh(time, block_mesh_dict, write=False)
+
+    assert not (temp_case_python / "constant" / "polyMesh").exists()
+    assert mesh.nCells() == 8000
+    assert mesh.nPoints() == 9261
+    assert mesh.nFaces() == 25200
+    assert mesh.nInternalFaces() == 22800
+    assert len(mesh.boundary()) > 0
+    assert meshing.checkMesh(mesh)["passed"]
+
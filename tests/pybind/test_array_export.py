@@ -0,0 +1,130 @@
+"""
+Test the zero-copy buffer protocol and DLPack export of fields and lists.
+"""
+
+import gc
+import os
+from typing import Any, Generator
+
+import numpy as np
+import pytest
+
+import pybFoam
+from pybFoam import boolList, labelList, scalarField, tensorField, vectorField
+
+
+@pytest.fixture(scope="function")
+def change_test_dir(request: Any) -> Generator[None, None, None]:
+    os.chdir(request.fspath.dirname)
+    yield
+    os.chdir(request.config.invocation_dir)
+
+
+def test_field_buffer() -> None:
+    f = scalarField(np.arange(5.0))
+    view = memoryview(f)
+    assert view.format == "d"
+    assert view.shape == (5,)
+    assert not view.readonly
+
+    arr = np.asarray(f)
+    arr[0] = 42.0
+    assert f[0] == 42.0
+
+    v = vectorField(np.arange(12.0).reshape(4, 3))
+    assert memoryview(v).shape == (4, 3)
+    v_np = np.asarray(v)
+    v_np[1, 2] = -1.0
+    assert v[1][2] == -1.0
+
+    assert np.asarray(tensorField(np.zeros((2, 9)))).shape == (2, 9)
+
+
+def test_tmp_field_buffer() -> None:
+    a = scalarField(np.arange(4.0))
+    arr = np.asarray(a * 2.0)  # view of the tmp result
+    gc.collect()
+    assert np.array_equal(arr, [0.0, 2.0, 4.0, 6.0])
+
+    v = vectorField(np.ones((3, 3)))
+    assert np.array_equal(np.asarray(v + v), np.full((3, 3), 2.0))
+
+
+def test_list_buffer() -> None:
+    labels = labelList([3, 1, 2])
+    arr = np.asarray(labels)
+    assert arr.dtype.kind == "i"
+    assert arr.tolist() == [3, 1, 2]
+    arr[1] = 7
+    assert labels[1] == 7
+
+    flags = boolList([True, False, True])
+    assert np.asarray(flags).dtype == np.bool_
+    assert np.asarray(flags).tolist() == [True, False, True]
+
+
+def test_dlpack() -> None:
+    f = scalarField(np.arange(6.0))
+    assert f.__dlpack_device__() == (1, 0)
+
+    arr = np.from_dlpack(f)
+    assert np.shares_memory(arr, np.asarray(f))
+    assert np.array_equal(arr, np.arange(6.0))
+
+    t = np.from_dlpack(vectorField(np.ones((2, 3))) * 3.0)
+    gc.collect()
+    assert np.array_equal(t, np.full((2, 3), 3.0))
+
+    assert np.from_dlpack(labelList([1, 2])).tolist() == [1, 2]
+
+
+def test_mesh_arrays(change_test_dir: Any) -> None:
+    time = pybFoam.Time(".", ".")
+    points = [
+        [0, 0, 0],
+        [1, 0, 0],
+        [1, 1, 0],
+        [0, 1, 0],
+        [0, 0, 1],
+        [1, 0, 1],
+        [1, 1, 1],
+        [0, 1, 1],
+    ]
+    faces = [
+        [0, 3, 2, 1],
+        [4, 5, 6, 7],
+        [0, 1, 5, 4],
+        [2, 3, 7, 6],
+        [0, 4, 7, 3],
+        [1, 2, 6, 5],
+    ]
+    io = pybFoam.IOobject(pybFoam.Word("hex"), pybFoam.fileName("constant"), time)
+    mesh = pybFoam.polyMesh(io, points, faces, [0] * 6, [])
+
+    assert np.array_equal(np.asarray(mesh.points()), points)
+    assert np.array_equal(np.asarray(mesh.owner()), np.zeros(6))
+
+    mesh_faces = mesh.faces()
+    assert len(mesh_faces) == 6
+    assert np.array_equal(mesh_faces[1], faces[1])
+    assert np.array_equal(mesh_faces[-1], faces[5])
+    assert not mesh_faces[1].flags.writeable
+    with pytest.raises(IndexError):
+        mesh_faces[6]
+    with pytest.raises(IndexError):
+        mesh_faces[-7]
+
+    offsets, labels = mesh.facesCSR()
+    assert offsets.tolist() == [0, 4, 8, 12, 16, 20, 24]
+    assert np.array_equal(labels.reshape(6, 4), faces)
+    assert not labels.flags.writeable
+
+    cell_offsets, cell_faces = mesh.cellsCSR()
+    assert cell_offsets.tolist() == [0, 6]
+    assert sorted(cell_faces.tolist()) == list(range(6))
+
+    # cached on the mesh and sharing the mesh storage
+    assert np.shares_memory(mesh.facesCSR()[1], labels)
+    assert np.shares_memory(mesh.pointsArray(), np.asarray(mesh.points()))
+    assert mesh.ownerArray().tolist() == [0] * 6
+    assert len(mesh.neighbourArray()) == 0
@@ -0,0 +1,84 @@
+"""
+Test lazily evaluated field expressions (scalarFieldExpr, vectorFieldExpr).
+
+field.expr() opts into lazy mode: operators only record the expression and
+the result is computed in a single pass on call, np.asarray or assign.
+"""
+
+import numpy as np
+import pytest
+
+from pybFoam import scalarField, scalarFieldExpr, vector, vectorField, vectorFieldExpr
+
+
+def test_expression_matches_eager() -> None:
+    """The complex benchmark expression gives the eager result."""
+    a = scalarField([1.1, 2.1, 3.1])
+    b = scalarField([2.2, 3.2, 4.2])
+    c = scalarField([3.3, 4.3, 5.3])
+    d = scalarField([4.4, 5.4, 6.4])
+
+    eager = scalarField(((a * b + c) * (d - a * c) + b) / (a + 1.0))
+
+    x = a.expr() * b + c
+    y = d - a.expr() * c
+    lazy = (x * y + b) / (a.expr() + 1.0)
+
+    assert isinstance(lazy, scalarFieldExpr)
+    assert len(lazy) == 3
+    assert np.allclose(np.asarray(lazy), np.asarray(eager))
+    assert np.allclose(np.asarray(lazy()), np.asarray(eager))
+
+
+def test_reflected_operators() -> None:
+    """Uniform values on the left-hand side."""
+    a = scalarField([1.0, 2.0, 4.0])
+    e = a.expr()
+
+    assert np.allclose(np.asarray(2.0 * e), [2.0, 4.0, 8.0])
+    assert np.allclose(np.asarray(1.0 + e), [2.0, 3.0, 5.0])
+    assert np.allclose(np.asarray(1.0 - e), [0.0, -1.0, -3.0])
+    assert np.allclose(np.asarray(4.0 / e), [4.0, 2.0, 1.0])
+    assert np.allclose(np.asarray(-e), [-1.0, -2.0, -4.0])
+
+
+def test_assign_in_place_with_aliasing() -> None:
+    """Assigning into an operand reads every block before writing it."""
+    a = scalarField([1.0, 2.0, 3.0])
+    b = scalarField([10.0, 20.0, 30.0])
+    np_a = np.asarray(a)
+
+    a.assign(b.expr() * 2.0 + a)
+
+    assert np.allclose(np_a, [21.0, 42.0, 63.0])
+
+    a += b.expr() * a
+    assert np.allclose(np_a, [231.0, 882.0, 1953.0])
+
+
+def test_vector_expression() -> None:
+    """Mixed scalar/vector expressions."""
+    s = scalarField([1.0, 2.0])
+    U = vectorField([[1.0, 0.0, 0.0], [0.0, 1.0, 2.0]])
+
+    e = s.expr() * U + U / s + vector(1, 1, 1)
+    assert isinstance(e, vectorFieldExpr)
+
+    expected = np.asarray(s)[:, None] * np.asarray(U) + np.asarray(U) / np.asarray(s)[:, None] + 1
+    assert np.asarray(e).shape == (2, 3)
+    assert np.allclose(np.asarray(e), expected)
+    assert np.allclose(np.asarray(vectorField(e)), expected)
+
+
+def test_tmp_operand() -> None:
+    """tmp results can take part in an expression."""
+    a = scalarField([1.0, 2.0, 3.0])
+    e = (a * 2.0).expr() + a
+    assert np.allclose(np.asarray(e), [3.0, 6.0, 9.0])
+
+
+def test_size_mismatch() -> None:
+    a = scalarField([1.0, 2.0, 3.0])
+    b = scalarField([1.0, 2.0])
+    with pytest.raises(RuntimeError):
+        a.expr() + b
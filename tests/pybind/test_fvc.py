@@ -5,7 +5,17 @@ import numpy as np
 import pytest
 
 import pybFoam
-from pybFoam import Time, createPhi, fvc, fvMesh, vector, volScalarField, volVectorField
+from pybFoam import (
+    Time,
+    createPhi,
+    fvc,
+    fvMesh,
+    fvMeshSubset,
+    surfaceScalarField,
+    vector,
+    volScalarField,
+    volVectorField,
+)
 
 
 @pytest.fixture(scope="function")
@@ -73,3 +83,274 @@ def test_fvc_reconstruct(change_test_dir: Any) -> None:
     np_recon = np.asarray(reconstructed()["internalField"])
     # Convert tmp to value if needed
     assert np.allclose(np_recon, [0.0, 0.0, 0.0], atol=1e-12)
+
+
+def test_fvc_cache(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    U = volVectorField.read_field(mesh, "U")
+
+    fvc.enable_cache()
+    fvc.clear_cache()
+    try:
+        grad_1 = fvc.grad(p_rgh)()
+        grad_2 = fvc.grad(p_rgh)()
+        assert fvc.cache_stats() == {"hits": 1, "misses": 1, "entries": 1}
+        assert np.array_equal(
+            np.asarray(grad_1["internalField"]), np.asarray(grad_2["internalField"])
+        )
+
+        fvc.interpolate(U)
+        fvc.interpolate(U)
+        assert fvc.cache_stats()["hits"] == 2
+
+        # Non-const access advances the event number of the field
+        p_rgh.correctBoundaryConditions()
+        fvc.grad(p_rgh)
+        assert fvc.cache_stats()["misses"] == 3
+
+        # Writes through a view need an explicit invalidation
+        values = np.asarray(p_rgh.internalField())
+        values[:] = np.linspace(0.0, 1.0, len(values))
+        fvc.invalidate_cache(p_rgh)
+        grad_3 = fvc.grad(p_rgh)()
+        assert np.any(np.asarray(grad_3["internalField"]) != 0.0)
+
+        # Entries are stored on the mesh and deleted with it
+        n_entries = fvc.cache_stats()["entries"]
+        time_2 = Time(".", ".")
+        mesh_2 = fvMesh(time_2)
+        fvc.grad(volScalarField.read_field(mesh_2, "p_rgh"))
+        assert fvc.cache_stats()["entries"] == n_entries + 1
+        del mesh_2, time_2
+        assert fvc.cache_stats()["entries"] == n_entries
+    finally:
+        fvc.enable_cache(False)
+        fvc.clear_cache()
+
+    assert not fvc.cache_enabled()
+
+
+def test_fvc_grad_interpolate_many(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    alpha = volScalarField.read_field(mesh, "alpha.water")
+    U = volVectorField.read_field(mesh, "U")
+
+    cell_centres = np.asarray(mesh.C()["internalField"])
+    np.asarray(p_rgh.internalField())[:] = cell_centres[:, 0] ** 2
+    np.asarray(alpha.internalField())[:] = np.sin(cell_centres[:, 1])
+    np.asarray(U.internalField())[:] = cell_centres * cell_centres[:, :1]
+    for field in (p_rgh, alpha, U):
+        field.correctBoundaryConditions()
+
+    grads = fvc.grad_many([p_rgh, alpha])
+    interps = fvc.interpolate_many([p_rgh, alpha])
+    for field, grad, interp in zip((p_rgh, alpha), grads, interps):
+        assert np.allclose(
+            np.asarray(grad()["internalField"]), np.asarray(fvc.grad(field)()["internalField"])
+        )
+        assert np.allclose(
+            np.asarray(interp()["internalField"]),
+            np.asarray(fvc.interpolate(field)()["internalField"]),
+        )
+
+    (grad_U,) = fvc.grad_many([U])
+    assert np.allclose(
+        np.asarray(grad_U()["internalField"]), np.asarray(fvc.grad(U)()["internalField"])
+    )
+
+    # None is rejected instead of dereferenced
+    missing: Any = None
+    with pytest.raises(TypeError):
+        fvc.grad_many([p_rgh, missing])
+    with pytest.raises(TypeError):
+        fvc.interpolate_many([U, missing])
+
+
+def hex_block_mesh(time: Time, n: int) -> fvMesh:
+    """In-memory n x n x n hex block on the unit cube, all faces in defaultFaces."""
+    x = np.linspace(0.0, 1.0, n + 1)
+    points = np.stack(np.meshgrid(x, x, x, indexing="ij")[::-1], axis=-1).reshape(-1, 3)
+
+    def vertex(i: Any, j: Any, k: Any) -> Any:
+        return (k * (n + 1) + j) * (n + 1) + i
+
+    k, j, i = np.meshgrid(np.arange(n), np.arange(n), np.arange(n), indexing="ij")
+    cells = np.stack(
+        [
+            vertex(i, j, k),
+            vertex(i + 1, j, k),
+            vertex(i + 1, j + 1, k),
+            vertex(i, j + 1, k),
+            vertex(i, j, k + 1),
+            vertex(i + 1, j, k + 1),
+            vertex(i + 1, j + 1, k + 1),
+            vertex(i, j + 1, k + 1),
+        ],
+        axis=-1,
+    ).reshape(-1, 8)
+
+    # region0 so the block reads the case system/fvSchemes
+    io = pybFoam.IOobject(pybFoam.Word("region0"), pybFoam.fileName("constant"), time)
+    poly = pybFoam.polyMesh(io, points, [("hex", cells.astype(np.int32))], [])
+    return fvMesh.fromPolyMesh(poly)
+
+
+def test_fvc_threaded(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    # 34^3 cells: above 4 * parallel::minChunkSize (8192), so 4 threads split the loops
+    mesh = hex_block_mesh(time, 34)
+    assert mesh.nCells() == 34**3
+
+    cell_centres = np.asarray(mesh.C()["internalField"])
+    U = volVectorField(pybFoam.Word("U"), mesh.C() / 1.0)
+    p_rgh = volScalarField(pybFoam.Word("p_rgh"), pybFoam.mag(U))
+    np.asarray(p_rgh.internalField())[:] = cell_centres[:, 0] ** 2
+    np.asarray(U.internalField())[:] = cell_centres * cell_centres[:, :1]
+    p_rgh.correctBoundaryConditions()
+    U.correctBoundaryConditions()
+    phi = fvc.flux(U)()
+
+    def evaluate() -> list[Any]:
+        return [
+            np.asarray(fvc.interpolate(p_rgh)()["internalField"]),
+            np.asarray(fvc.interpolate(U)()["internalField"]),
+            np.asarray(fvc.div(U)()["internalField"]),
+            np.asarray(fvc.div(phi)()["internalField"]),
+            np.asarray(fvc.div(phi, U)()["internalField"]),
+            np.asarray(fvc.surfaceSum(phi)()["internalField"]),
+            np.asarray(fvc.surfaceSum(fvc.interpolate(U))()["internalField"]),
+        ]
+
+    serial = [values.copy() for values in evaluate()]
+    pybFoam.set_num_threads(4)
+    try:
+        assert fvc.get_num_threads() == 4
+        threaded = evaluate()
+    finally:
+        pybFoam.set_num_threads(1)
+
+    for expected, values in zip(serial, threaded):
+        assert np.allclose(values, expected, rtol=1e-12, atol=1e-12)
+
+
+def test_flux_statistics(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    U = volVectorField.read_field(mesh, "U")
+
+    cell_centres = np.asarray(mesh.C()["internalField"])
+    np.asarray(U.internalField())[:] = np.sin(cell_centres * 7.0)
+    U.correctBoundaryConditions()
+    phi = fvc.flux(U)()
+
+    Co = volScalarField(pybFoam.mag(U))
+    max_co, mean_co, local_err, global_err = pybFoam.computeFluxStatistics(phi, Co)
+    assert (max_co, mean_co) == pybFoam.computeCFLNumber(phi)
+    assert (local_err, global_err) == pybFoam.computeContinuityErrors(phi)
+
+    # Reference: surfaceSum(mag(phi)) and div(phi) from OpenFOAM
+    mag_phi = surfaceScalarField(phi)
+    np.asarray(mag_phi.internalField())[:] = np.abs(np.asarray(phi.internalField()))
+    mag_phi.setBoundaryArray(np.abs(phi.boundaryArray()))
+    V = np.asarray(mesh.V())
+    delta_t = time.deltaTValue()
+
+    co_ref = 0.5 * np.asarray(fvc.surfaceSum(mag_phi)()["internalField"]) / V * delta_t
+    assert np.allclose(np.asarray(Co.internalField()), co_ref)
+    assert np.isclose(max_co, co_ref.max())
+    assert np.isclose(mean_co, np.sum(co_ref * V) / np.sum(V))
+
+    div_phi = np.asarray(fvc.div(phi)()["internalField"])
+    assert np.isclose(local_err, delta_t * np.sum(np.abs(div_phi) * V) / np.sum(V))
+    assert np.isclose(global_err, delta_t * np.sum(div_phi * V) / np.sum(V), atol=1e-12)
+
+
+def test_field_integrals(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    U = volVectorField.read_field(mesh, "U")
+
+    cell_centres = np.asarray(mesh.C()["internalField"])
+    np.asarray(p_rgh.internalField())[:] = cell_centres[:, 0] ** 2
+    np.asarray(U.internalField())[:] = np.sin(cell_centres * 5.0)
+    p_rgh.correctBoundaryConditions()
+    U.correctBoundaryConditions()
+
+    V = np.asarray(mesh.V())
+    p = np.asarray(p_rgh.internalField())
+    u = np.asarray(U.internalField())
+
+    assert np.isclose(pybFoam.domainIntegrate(p_rgh), np.sum(p * V))
+    assert np.isclose(pybFoam.weightedAverage(p_rgh), np.sum(p * V) / np.sum(V))
+    U_integral = pybFoam.domainIntegrate(U)
+    U_average = pybFoam.weightedAverage(U)
+    U_ref = np.sum(u * V[:, None], axis=0)
+    assert np.allclose([U_integral[i] for i in range(3)], U_ref)
+    assert np.allclose([U_average[i] for i in range(3)], U_ref / np.sum(V))
+
+    # Patch integrals are weighted by the face areas
+    mag_sf = mesh.magSf().boundaryArray()
+    offsets = p_rgh.boundaryOffsets()
+    p_boundary = p_rgh.boundaryArray()
+    integrals = pybFoam.patchIntegrals(p_rgh)
+    for name in ["lowerWall", "atmosphere"]:
+        patchi = p_rgh.patchIndex(name)
+        faces = slice(offsets[patchi], offsets[patchi + 1])
+        ref = np.sum(p_boundary[faces] * mag_sf[faces])
+        assert np.isclose(pybFoam.patchIntegrate(p_rgh, name), ref)
+        assert np.isclose(integrals[name], ref)
+        assert np.isclose(pybFoam.patchAverage(p_rgh, name), ref / np.sum(mag_sf[faces]))
+
+    phi = fvc.flux(U)()
+    assert set(pybFoam.patchIntegrals(phi)) == set(integrals)
+
+    with pytest.raises(RuntimeError):
+        pybFoam.cellZoneIntegrate(p_rgh, "noSuchZone")
+    with pytest.raises(RuntimeError):
+        pybFoam.patchIntegrate(p_rgh, "noSuchPatch")
+
+
+def test_fvc_cell_region(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    U = volVectorField.read_field(mesh, "U")
+
+    cell_centres = np.asarray(mesh.C()["internalField"])
+    np.asarray(p_rgh.internalField())[:] = cell_centres[:, 0] ** 2
+    np.asarray(U.internalField())[:] = np.sin(cell_centres * 5.0)
+    p_rgh.correctBoundaryConditions()
+    U.correctBoundaryConditions()
+    phi = fvc.flux(U)()
+
+    cells = np.nonzero(cell_centres[:, 0] < np.median(cell_centres[:, 0]))[0].astype(np.int32)
+    region = fvc.cellRegion(mesh, cells)
+    assert len(region) == len(cells)
+    assert np.array_equal(region.cells(), cells)
+    assert region.nFaces() < mesh.nFaces()
+
+    def full(values: Any) -> Any:
+        return np.asarray(values()["internalField"])[cells]
+
+    assert np.allclose(region.grad(p_rgh), full(fvc.grad(p_rgh)))
+    assert np.allclose(region.grad(U), full(fvc.grad(U)))
+    assert np.allclose(region.div(U), full(fvc.div(U)))
+    assert np.allclose(region.div(phi), full(fvc.div(phi)))
+    assert np.allclose(region.div(phi, U), full(fvc.div(phi, U)))
+
+    with pytest.raises(RuntimeError):
+        fvc.cellRegion(mesh, "noSuchZone")
+
+    # Subset mesh for fvm/fvc on the region only
+    subset = fvMeshSubset(mesh, cells)
+    assert subset.subMesh().nCells() == len(cells)
+    assert np.array_equal(subset.cellMap(), cells)
+    p_sub = subset.interpolate(p_rgh)()
+    assert np.allclose(
+        np.asarray(p_sub["internalField"]), np.asarray(p_rgh["internalField"])[cells]
+    )
@@ -1,14 +1,24 @@
 import os
-from typing import Any, Generator
+from typing import Any, Generator, Union
 
+import numpy as np
 import pytest
 
+import pybFoam
 from pybFoam import (
+    SolverScalarPerformance,
+    SolverVectorPerformance,
     Time,
+    Word,
     fvm,
     fvMesh,
     fvScalarMatrix,
     fvVectorMatrix,
+    pythonSolverSystem,
+    register_linear_solver,
+    solve_all,
+    telemetry,
+    unregister_linear_solver,
     volScalarField,
     volVectorField,
 )
@@ -30,3 +40,236 @@ def test_fvm(change_test_dir: Any) -> None:
 
     fvScalarMatrix(fvm.laplacian(p_rgh))
     fvVectorMatrix(fvm.laplacian(U))
+
+
+def test_fvMatrix_ldu_csr_export(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    p_eqn = fvScalarMatrix(fvm.laplacian(p_rgh))
+
+    diag = p_eqn.diagArray()
+    upper = p_eqn.upperArray()
+    lower = p_eqn.lowerArray()
+    owner, neighbour = p_eqn.lduAddressing()
+    assert not diag.flags.writeable
+    assert len(upper) == len(lower) == len(owner) == len(neighbour)
+    assert p_eqn.symmetric()
+    assert len(p_eqn.patchAddressing()) == len(p_eqn.internalCoeffsArrays())
+
+    indptr, indices = p_eqn.csrPattern()
+    n_cells = len(diag)
+    assert len(indptr) == n_cells + 1
+    assert indptr[-1] == len(indices) == n_cells + 2 * len(upper)
+
+    # CSR product equals the LDU product without boundary contributions
+    x = np.linspace(0.0, 1.0, n_cells)
+    values = p_eqn.csrValues(boundary=False)
+    rows = np.repeat(np.arange(n_cells), np.diff(indptr))
+    y_csr = np.zeros(n_cells)
+    np.add.at(y_csr, rows, values * x[indices])
+
+    y_ldu = diag * x
+    np.add.at(y_ldu, owner, upper * x[neighbour])
+    np.add.at(y_ldu, neighbour, lower * x[owner])
+    assert np.allclose(y_csr, y_ldu)
+
+    # The boundary adds the internalCoeffs to the diagonal only
+    out = np.empty(len(indices))
+    result = p_eqn.csrValues(out=out)
+    assert np.shares_memory(result, out)
+    boundary_diag = np.array(diag)
+    for cells, coeffs in zip(p_eqn.patchAddressing(), p_eqn.internalCoeffsArrays()):
+        np.add.at(boundary_diag, cells, coeffs)
+    diag_pos = indptr[:-1] + np.array(
+        [np.searchsorted(indices[indptr[i] : indptr[i + 1]], i) for i in range(n_cells)]
+    )
+    assert np.allclose(out[diag_pos], boundary_diag)
+    assert len(p_eqn.csrSource()) == n_cells
+
+
+def test_python_linear_solver(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    calls = []
+
+    def dense_solve(system: pythonSolverSystem) -> int:
+        indptr, indices = system.csrPattern()
+        values = system.csrValues()
+        n = len(indptr) - 1
+        A = np.zeros((n, n))
+        A[np.repeat(np.arange(n), np.diff(indptr)), indices] = values
+        system.psi()[:] = np.linalg.solve(A, system.source())
+        assert np.allclose(system.residual(system.psi()), 0.0, atol=1e-8)
+        calls.append(system)
+        return 1
+
+    register_linear_solver("denseSolve", dense_solve)
+    try:
+        p_eqn = fvScalarMatrix(fvm.laplacian(p_rgh))
+        p_eqn.solve(Word("p_rghPython"))
+    finally:
+        unregister_linear_solver("denseSolve")
+
+    assert len(calls) == 1
+    with pytest.raises(RuntimeError):
+        calls[0].psi()  # only valid during the callback
+
+    # An exception keeps its type and leaves the matrix unchanged
+    def failing_solve(system: pythonSolverSystem) -> int:
+        raise ValueError("no convergence")
+
+    register_linear_solver("denseSolve", failing_solve)
+    try:
+        p_eqn = fvScalarMatrix(fvm.laplacian(p_rgh))
+        diag = p_eqn.diagArray().copy()
+        with pytest.raises(ValueError, match="no convergence"):
+            p_eqn.solve(Word("p_rghPython"))
+        assert np.array_equal(p_eqn.diagArray(), diag)
+    finally:
+        unregister_linear_solver("denseSolve")
+
+
+def test_solve_all(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    U = volVectorField.read_field(mesh, "U")
+    p_values = np.asarray(p_rgh.internalField())
+    U_values = np.asarray(U.internalField())
+    p0 = p_values.copy()
+    U0 = U_values.copy()
+
+    fvScalarMatrix(fvm.laplacian(p_rgh)).solve()
+    fvVectorMatrix(fvm.laplacian(U)).solve()
+    p_serial = p_values.copy()
+    U_serial = U_values.copy()
+
+    p_values[:] = p0
+    U_values[:] = U0
+    pybFoam.set_num_threads(4)
+    try:
+        perf = solve_all([fvScalarMatrix(fvm.laplacian(p_rgh)), fvVectorMatrix(fvm.laplacian(U))])
+    finally:
+        pybFoam.set_num_threads(1)
+
+    assert isinstance(perf[0], SolverScalarPerformance)
+    assert isinstance(perf[1], SolverVectorPerformance)
+    assert str(perf[0].fieldName()) == "p_rgh"
+    assert np.allclose(p_values, p_serial)
+    assert np.allclose(U_values, U_serial)
+
+    p_eqn = fvScalarMatrix(fvm.laplacian(p_rgh))
+    with pytest.raises(RuntimeError):
+        solve_all([p_eqn, p_eqn])  # both solve for p_rgh
+
+
+def test_solve_all_failing_job(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    U = volVectorField.read_field(mesh, "U")
+
+    # Named after the fvSolution entry of the Python solver; calculated
+    # patches only allow a source term
+    p_python = volScalarField(Word("p_rghPython"), p_rgh / 1.0)
+    rate = pybFoam.dimensionedScalar("rate", pybFoam.dimless, 1.0)
+    np.asarray(U.internalField())[:] = np.asarray(mesh.C()["internalField"])
+    p0 = np.asarray(p_python.internalField()).copy()
+    U0 = np.asarray(U.internalField()).copy()
+
+    def failing_solve(system: pythonSolverSystem) -> int:
+        raise ValueError("no convergence")
+
+    register_linear_solver("denseSolve", failing_solve)
+    pybFoam.set_num_threads(4)
+    try:
+        with pytest.raises(ValueError, match="no convergence"):
+            solve_all([fvVectorMatrix(fvm.laplacian(U)), fvScalarMatrix(fvm.Sp(rate, p_python))])
+    finally:
+        pybFoam.set_num_threads(1)
+        unregister_linear_solver("denseSolve")
+
+    # The other jobs finished, but no field is written
+    assert np.array_equal(np.asarray(p_python.internalField()), p0)
+    assert np.array_equal(np.asarray(U.internalField()), U0)
+
+
+def test_solve_telemetry(change_test_dir: Any, tmp_path: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    U = volVectorField.read_field(mesh, "U")
+
+    telemetry.enable(capacity=4)
+    telemetry.clear()
+    telemetry.open(tmp_path / "solves.bin")
+    try:
+        for _ in range(3):
+            fvScalarMatrix(fvm.laplacian(p_rgh)).solve()
+        solve_all([fvVectorMatrix(fvm.laplacian(U))])
+    finally:
+        telemetry.disable()
+        telemetry.close()
+
+    records = telemetry.records()
+    assert len(records) == 4
+    assert records.field_names() == ["p_rgh"] * 3 + ["U"]
+    assert records.solver_names()[0] == "GAMG"
+    assert np.all(records.wall_time > 0.0)
+    assert records.iterations[0] > 0
+    assert records.select("U").tolist() == [False, False, False, True]
+
+    written = telemetry.read_solve_telemetry(tmp_path / "solves.bin")
+    assert written.field_names() == records.field_names()
+    assert np.array_equal(written.final_residual, records.final_residual)
+
+    # Disabled: nothing is recorded
+    fvScalarMatrix(fvm.laplacian(p_rgh)).solve()
+    assert len(telemetry.records()) == 4
+    telemetry.clear()
+
+
+def check_Amul_residual(eqn: Union[fvScalarMatrix, fvVectorMatrix], cmpt: int) -> None:
+    indptr, indices = eqn.csrPattern()
+    values = eqn.csrValues(cmpt=cmpt)
+    n_cells = len(indptr) - 1
+    rows = np.repeat(np.arange(n_cells), np.diff(indptr))
+    x = np.linspace(-1.0, 1.0, n_cells)
+
+    # No coupled patches: the CSR matrix is the whole operator
+    expected = np.zeros(n_cells)
+    np.add.at(expected, rows, values * x[indices])
+    assert np.allclose(eqn.Amul(x, cmpt=cmpt), expected)
+
+    out = np.empty(n_cells)
+    r = eqn.residual(x, out=out, cmpt=cmpt)
+    assert np.shares_memory(r, out)
+    source = eqn.csrSource()
+    b = source if source.ndim == 1 else source[:, cmpt]
+    assert np.allclose(out, b - expected)
+
+    # x and out may be the same buffer
+    y = x.copy()
+    eqn.Amul(y, out=y, cmpt=cmpt)
+    assert np.allclose(y, expected)
+
+    with pytest.raises(RuntimeError):
+        eqn.Amul(x, out=np.empty(n_cells + 1), cmpt=cmpt)
+
+    # out is never replaced by a converted copy
+    with pytest.raises(TypeError):
+        eqn.Amul(x, out=np.empty(n_cells, dtype=np.float32), cmpt=cmpt)
+    with pytest.raises(TypeError):
+        eqn.Amul(x, out=np.empty(2 * n_cells)[::2], cmpt=cmpt)
+
+
+def test_fvMatrix_Amul_residual(change_test_dir: Any) -> None:
+    time = Time(".", ".")
+    mesh = fvMesh(time)
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    U = volVectorField.read_field(mesh, "U")
+
+    check_Amul_residual(fvScalarMatrix(fvm.laplacian(p_rgh)), 0)
+    check_Amul_residual(fvVectorMatrix(fvm.laplacian(U)), 1)
@@ -172,6 +172,32 @@ def test_tmp_scalar_arithmetic_operators(change_test_dir: Any) -> None:
     assert result_rtruediv["internalField"][0] == 5.0
 
 
+def test_boundary_array(change_test_dir: Any) -> None:
+    time = pybFoam.Time(".", ".")
+    mesh = pybFoam.fvMesh(time)
+    p_rgh = pybFoam.volScalarField.read_field(mesh, "p_rgh")
+
+    # leftWall, rightWall, lowerWall, atmosphere, defaultFaces (empty)
+    offsets = p_rgh.boundaryOffsets()
+    assert offsets.tolist() == [0, 50, 100, 162, 208, 208]
+    assert p_rgh.patchIndex("lowerWall") == 2
+    with pytest.raises(RuntimeError):
+        p_rgh.patchIndex("noSuchPatch")
+
+    values = np.arange(208, dtype=float)
+    p_rgh.setBoundaryArray(values)
+    assert np.array_equal(np.asarray(p_rgh["lowerWall"]), values[100:162])
+    assert np.array_equal(p_rgh.boundaryArray(), values)
+
+    U = pybFoam.volVectorField.read_field(mesh, "U")
+    U_values = np.ones((208, 3))
+    U.setBoundaryArray(U_values)
+    assert U.boundaryArray().shape == (208, 3)
+    assert np.array_equal(np.asarray(U["atmosphere"]), U_values[162:])
+    with pytest.raises(RuntimeError):
+        U.setBoundaryArray(np.ones((10, 3)))
+
+
 # def test_mesh(change_test_dir):
 
 #     time = pybFoam.Time(".", ".")
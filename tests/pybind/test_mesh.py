@@ -0,0 +1,101 @@
+"""
+Test the in-memory construction of an fvMesh from a polyMesh.
+"""
+
+import os
+from typing import Any, Generator
+
+import numpy as np
+import pytest
+
+import pybFoam
+
+
+@pytest.fixture(scope="function")
+def change_test_dir(request: Any) -> Generator[None, None, None]:
+    os.chdir(request.fspath.dirname)
+    yield
+    os.chdir(request.config.invocation_dir)
+
+
+def test_fvmesh_from_polymesh(change_test_dir: Any) -> None:
+    time = pybFoam.Time(".", ".")
+    points = [
+        [0, 0, 0],
+        [2, 0, 0],
+        [2, 1, 0],
+        [0, 1, 0],
+        [0, 0, 1],
+        [2, 0, 1],
+        [2, 1, 1],
+        [0, 1, 1],
+    ]
+    walls = [[0, 4, 7, 3], [1, 2, 6, 5], [0, 1, 5, 4], [3, 7, 6, 2]]
+    io = pybFoam.IOobject(pybFoam.Word("inMemoryHex"), pybFoam.fileName("constant"), time)
+    poly = pybFoam.polyMesh(
+        io,
+        points,
+        [("hex", list(range(8)))],
+        [("walls", walls)],
+        defaultPatchName="frontAndBack",
+    )
+
+    mesh = pybFoam.fvMesh.fromPolyMesh(poly)
+
+    assert not os.path.exists("constant/inMemoryHex")
+    assert mesh.nCells() == 1
+    assert mesh.nFaces() == 6
+    assert [str(p.name()) for p in mesh.boundary()] == ["walls", "frontAndBack"]
+    assert [p.size() for p in mesh.boundary()] == [4, 2]
+    assert np.isclose(np.asarray(mesh.V())[0], 2.0)
+    assert np.allclose(np.asarray(mesh.C()["internalField"])[0], [1.0, 0.5, 0.5])
+
+
+def test_polymesh_from_arrays(change_test_dir: Any) -> None:
+    time = pybFoam.Time(".", ".")
+    # two unit cubes along x
+    points = np.array([[x, y, z] for z in (0.0, 1.0) for y in (0.0, 1.0) for x in (0.0, 1.0, 2.0)])
+    cells = np.array([[0, 1, 4, 3, 6, 7, 10, 9], [1, 2, 5, 4, 7, 8, 11, 10]], dtype=np.int32)
+    walls = np.array([[0, 6, 9, 3], [2, 5, 11, 8]], dtype=np.int32)
+    io = pybFoam.IOobject(pybFoam.Word("arrayHexes"), pybFoam.fileName("constant"), time)
+
+    mesh = pybFoam.polyMesh(
+        io,
+        points,
+        [("hex", cells)],
+        [("walls", np.array([0, 4, 8], dtype=np.int32), walls.ravel())],
+    )
+    assert mesh.nCells() == 2
+    assert mesh.nInternalFaces() == 1
+    assert mesh.nFaces() == 11
+    assert [str(p.name()) for p in mesh.boundaryMesh()] == ["walls", "defaultFaces"]
+    assert np.array_equal(mesh.pointsArray(), points)
+
+    # round trip through the CSR topology
+    offsets, labels = mesh.facesCSR()
+    io_csr = pybFoam.IOobject(pybFoam.Word("csrHexes"), pybFoam.fileName("constant"), time)
+    copy = pybFoam.polyMesh(
+        io_csr,
+        mesh.pointsArray().copy(),
+        offsets.copy(),
+        labels.copy(),
+        mesh.ownerArray().copy(),
+        mesh.neighbourArray().copy(),
+    )
+    assert copy.nCells() == 2
+    assert np.array_equal(copy.facesCSR()[1], labels)
+    assert np.array_equal(copy.ownerArray(), mesh.ownerArray())
+
+    bad_offsets = offsets.copy()
+    bad_offsets[-1] += 1
+    with pytest.raises(RuntimeError):
+        pybFoam.polyMesh(
+            io_csr,
+            points,
+            bad_offsets,
+            labels.copy(),
+            mesh.ownerArray().copy(),
+            mesh.neighbourArray().copy(),
+        )
+    with pytest.raises(RuntimeError):
+        pybFoam.polyMesh(io, points, [("hex", cells[:, :6].copy())], [])
@@ -1,4 +1,5 @@
 import numpy as np
+import pytest
 
 from pybFoam import Word, mag, scalarField, tensor, tensorField, vector, vectorField
 
@@ -90,6 +91,39 @@ def test_tensor_field_buffer() -> None:
     assert f[0][0] == 10.0
 
 
+def test_field_from_numpy() -> None:
+    s = np.arange(5, dtype=np.float64)
+    sf = scalarField(s)
+    assert np.allclose(np.asarray(sf), s)
+    s[0] = 42.0  # the field owns a copy
+    assert sf[0] == 0.0
+
+    v = np.arange(12, dtype=np.float64).reshape(4, 3)
+    vf = vectorField(v)
+    assert np.allclose(np.asarray(vf), v)
+
+    # non-contiguous and float32 input is converted before the bulk copy
+    assert np.allclose(np.asarray(vectorField(v[::2])), v[::2])
+    assert np.allclose(np.asarray(scalarField(s.astype(np.float32))), s)
+
+    t = np.arange(18, dtype=np.float64).reshape(2, 9)
+    assert np.allclose(np.asarray(tensorField(t)), t)
+
+
+def test_field_copy_from() -> None:
+    vf = vectorField(np.zeros((4, 3)))
+    a = np.asarray(vf)
+
+    v = np.arange(12, dtype=np.float64).reshape(4, 3)
+    vf.copy_from(v)
+    assert np.allclose(a, v)  # storage is reused
+
+    with pytest.raises(RuntimeError):
+        vf.copy_from(np.zeros((3, 3)))
+    with pytest.raises(RuntimeError):
+        vf.copy_from(np.zeros(12))
+
+
 def test_scalarField() -> None:
     sf = scalarField()
     assert len(sf) == 0
@@ -4,6 +4,7 @@ from typing import Any, Generator
 import numpy as np
 import pytest
 
+import pybFoam
 from pybFoam import (
     Time,
     Word,
@@ -13,14 +14,21 @@ from pybFoam import (
     volVectorField,
 )
 from pybFoam.sampling import (
+    Probes,
+    UniformSetConfig,
     interpolationScalar,
     interpolationVector,
     meshSearch,
+    read_probes,
     sampledSet,
     sampleSetScalar,
     sampleSetVector,
+    sampleSetWeights,
 )
 
+# Above 4 * parallel::minChunkSize (8192), so 4 threads split the samples
+N_THREADED = 40_000
+
 
 @pytest.fixture(scope="function")
 def change_test_dir(request: Any) -> Generator[None, None, None]:
@@ -60,6 +68,46 @@ def test_meshSearch_find_cell(change_test_dir: Any) -> None:
     assert cell_id < mesh.nCells()
 
 
+@pytest.mark.parametrize("n_threads", [1, 4])
+def test_meshSearch_find_cells(change_test_dir: Any, n_threads: int) -> None:
+    """Batched searches agree with the per-point calls."""
+    _, mesh = create_time_mesh()
+    search = meshSearch(mesh)
+
+    rng = np.random.default_rng(0)
+    points = rng.random((N_THREADED, 3)) * [1.2, 1.2, 0.01] - [0.1, 0.1, 0.0]
+
+    pybFoam.set_num_threads(n_threads)
+    try:
+        cells = search.findCells(points)
+        nearest = search.findNearestCells(points)
+        seeds = np.where(cells >= 0, cells, 0).astype(cells.dtype)
+        seeded = search.findCells(points, seeds)
+    finally:
+        pybFoam.set_num_threads(1)
+
+    assert cells.shape == (N_THREADED,)
+    assert np.any(cells == -1)  # some points are outside the domain
+    for i in range(0, N_THREADED, 97):
+        p = vector(*points[i])
+        assert cells[i] == search.findCell(p)
+        assert nearest[i] == search.findNearestCell(p)
+    assert np.array_equal(seeded, cells)
+
+    # All points against a serial batch
+    assert np.array_equal(search.findCells(points), cells)
+    assert np.array_equal(search.findNearestCells(points), nearest)
+
+    with pytest.raises(RuntimeError):
+        search.findCells(points, seeds[:10])
+    bad_seeds = seeds.copy()
+    bad_seeds[5] = mesh.nCells()
+    with pytest.raises(RuntimeError):
+        search.findCells(points, bad_seeds)
+    with pytest.raises(RuntimeError):
+        search.findCell(vector(*points[0]), -2)
+
+
 def test_sampledSet_uniform_line(change_test_dir: Any) -> None:
     """Test creation of uniform line sampledSet."""
     from pybFoam.sampling import UniformSetConfig
@@ -549,3 +597,145 @@ def test_sample_multiple_fields_on_same_set(change_test_dir: Any) -> None:
 
     # Should have same validity
     assert np.array_equal(valid_p, valid_U)
+
+
+@pytest.mark.parametrize("scheme", ["cell", "cellPoint", "cellPointFace"])
+@pytest.mark.parametrize("n_threads", [1, 4])
+def test_sample_set_weights(change_test_dir: Any, scheme: str, n_threads: int) -> None:
+    """Sampling with cached weights matches the per-call interpolation."""
+    _, mesh = create_time_mesh()
+    search = meshSearch(mesh)
+
+    U = volVectorField.read_field(mesh, "U")
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    centres = np.asarray(mesh.C()["internalField"])
+    np.asarray(U["internalField"])[:] = centres * [1.0, 2.0, 0.0]
+    np.asarray(p_rgh["internalField"])[:] = centres[:, 0] + centres[:, 1]
+
+    config = UniformSetConfig(
+        axis="distance", start=[-0.1, 0.1, 0.005], end=[0.55, 0.55, 0.005], nPoints=N_THREADED
+    )
+    line = sampledSet.New(Word("weightLine"), mesh, search, config.to_foam_dict())
+    weights = sampleSetWeights(line)
+    assert weights.size() == line.nPoints()
+
+    interp_U = interpolationVector.New(Word(scheme), U)
+    interp_p = interpolationScalar.New(Word(scheme), p_rgh)
+
+    pybFoam.set_num_threads(n_threads)
+    try:
+        for _ in range(2):  # weights are reused
+            assert np.array_equal(
+                np.asarray(sampleSetVector(weights, interp_U)),
+                np.asarray(sampleSetVector(line, interp_U)),
+            )
+            assert np.array_equal(
+                np.asarray(sampleSetScalar(weights, interp_p)),
+                np.asarray(sampleSetScalar(line, interp_p)),
+            )
+    finally:
+        pybFoam.set_num_threads(1)
+
+
+def test_probes_ring_buffer_and_file(change_test_dir: Any, tmp_path: Any) -> None:
+    """Probes keep the latest steps in memory and stream all steps to a file."""
+    _, mesh = create_time_mesh()
+
+    U = volVectorField.read_field(mesh, "U")
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    centres = np.asarray(mesh.C()["internalField"])
+    points = np.ascontiguousarray(centres[::25])
+
+    probes = Probes(mesh, points, scheme="cell", capacity=4)
+    assert probes.nProbes() == len(points)
+    cells = np.asarray(probes.cells())
+    assert np.array_equal(cells, np.arange(len(centres))[::25])
+
+    probes.add("p_rgh", p_rgh)
+    probes.add("U", U)
+
+    n_steps = 10
+    for step in range(n_steps):
+        np.asarray(p_rgh["internalField"])[:] = centres[:, 0] + step
+        np.asarray(U["internalField"])[:] = centres * step
+        probes.record(0.1 * step)
+    assert probes.nRecorded() == n_steps
+
+    # Only the last capacity steps are kept
+    assert np.allclose(probes.times(), 0.1 * np.arange(6, 10))
+    p_values = probes.values("p_rgh")
+    assert p_values.shape == (4, len(points))
+    assert np.array_equal(p_values[-1], centres[cells, 0] + 9)
+    assert probes.values("U").shape == (4, len(points), 3)
+
+    with pytest.raises(RuntimeError):
+        probes.add("p_rgh2", p_rgh)
+
+    # The file starts with the steps still in memory
+    path = tmp_path / "probes.bin"
+    probes.open(str(path))
+    for step in range(n_steps, 2 * n_steps):
+        np.asarray(p_rgh["internalField"])[:] = centres[:, 0] + step
+        np.asarray(U["internalField"])[:] = centres * step
+        probes.record(0.1 * step)
+    probes.close()
+
+    data = read_probes(path)
+    steps = np.arange(6, 2 * n_steps)
+    assert np.allclose(data.times, 0.1 * steps)
+    assert np.array_equal(data.points, points)
+    assert data.fields["p_rgh"].shape == (len(steps), len(points))
+    assert np.array_equal(data.fields["p_rgh"], centres[cells, 0][None, :] + steps[:, None])
+    assert np.array_equal(data.fields["U"], centres[cells][None, :, :] * steps[:, None, None])
+
+
+def test_probes_cell_point(change_test_dir: Any) -> None:
+    """cellPoint probes of a uniform field return the field value."""
+    _, mesh = create_time_mesh()
+
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    centres = np.asarray(mesh.C()["internalField"])
+    points = np.ascontiguousarray(centres[::25] + [1e-4, 1e-4, 0.0])
+    field = np.asarray(p_rgh["internalField"])
+
+    def set_uniform(value: float) -> None:
+        field[:] = value
+        p_rgh.setBoundaryArray(np.full_like(p_rgh.boundaryArray(), value))
+
+    probes = Probes(mesh, points)
+    probes.add("p_rgh", p_rgh)
+    set_uniform(2.5)
+    probes.record(0.0)
+    assert np.allclose(probes.values("p_rgh")[0], 2.5, rtol=0.0, atol=1e-12)
+
+    # The interpolation is built once: its point values follow the field
+    set_uniform(-1.0)
+    probes.record(1.0)
+    assert np.allclose(probes.values("p_rgh")[1], -1.0, rtol=0.0, atol=1e-12)
+
+
+def test_probes_cell_point_follows_field(change_test_dir: Any) -> None:
+    """cellPoint probes match freshly built probes after the field changes."""
+    _, mesh = create_time_mesh()
+
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    centres = np.asarray(mesh.C()["internalField"])
+    points = np.ascontiguousarray(centres[::25] + [1e-4, 1e-4, 0.0])
+    field = np.asarray(p_rgh["internalField"])
+
+    probes = Probes(mesh, points)
+    probes.add("p_rgh", p_rgh)
+    field[:] = centres[:, 0]
+    p_rgh.correctBoundaryConditions()
+    probes.record(0.0)
+
+    field[:] = centres[:, 0] ** 2
+    p_rgh.correctBoundaryConditions()
+    probes.record(1.0)
+
+    fresh = Probes(mesh, points)
+    fresh.add("p_rgh", p_rgh)
+    fresh.record(1.0)
+    values = probes.values("p_rgh")
+    assert np.allclose(values[1], fresh.values("p_rgh")[0], rtol=1e-12)
+    assert not np.allclose(values[1], values[0])
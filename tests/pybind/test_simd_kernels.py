@@ -0,0 +1,114 @@
+"""
+Test the SIMD vector/tensor field kernels (pybFoam.set_simd_isa).
+
+Every instruction set must give bitwise identical results, the values are
+checked against numpy.
+"""
+
+import os
+from typing import Any, Callable, Generator
+
+import numpy as np
+import pytest
+
+import pybFoam
+from pybFoam import fvc, scalarField, vector, vectorField
+
+N = 1003  # not a multiple of the SIMD width
+
+ISAS = ["scalar", "avx2", "avx512"]
+
+
+@pytest.fixture(scope="function")
+def change_test_dir(request: Any) -> Generator[None, None, None]:
+    os.chdir(request.fspath.dirname)
+    yield
+    os.chdir(request.config.invocation_dir)
+
+
+@pytest.fixture
+def restore_isa() -> Generator[None, None, None]:
+    isa = pybFoam.simd_isa()
+    yield
+    pybFoam.set_simd_isa(isa)
+
+
+def results_per_isa(func: Callable[[], Any]) -> list[np.ndarray]:
+    results = []
+    for isa in ISAS:
+        pybFoam.set_simd_isa(isa)
+        results.append(np.array(func()))
+    return results
+
+
+def assert_identical(results: list[np.ndarray], expected: np.ndarray) -> None:
+    assert np.allclose(results[0], expected)
+    for r in results[1:]:
+        assert np.array_equal(r, results[0])
+
+
+def test_simd_isa(restore_isa: None) -> None:
+    assert pybFoam.simd_isa() in ISAS
+    pybFoam.set_simd_isa("scalar")
+    assert pybFoam.simd_isa() == "scalar"
+    with pytest.raises(RuntimeError):
+        pybFoam.set_simd_isa("sse2")
+
+
+def test_vector_field_kernels(restore_isa: None) -> None:
+    rng = np.random.default_rng(0)
+    a_np = rng.random((N, 3))
+    b_np = rng.random((N, 3))
+    s_np = rng.random(N) + 0.5
+    a = vectorField(a_np)
+    b = vectorField(b_np)
+    s = scalarField(s_np)
+
+    assert_identical(results_per_isa(lambda: a & b), np.sum(a_np * b_np, axis=1))
+    assert_identical(results_per_isa(lambda: a & vector(1, 2, 3)), a_np @ np.array([1.0, 2.0, 3.0]))
+    assert_identical(results_per_isa(lambda: a * s), a_np * s_np[:, None])
+    assert_identical(results_per_isa(lambda: a / s), a_np / s_np[:, None])
+    assert_identical(
+        results_per_isa(lambda: (a * s) & b), np.sum(a_np * s_np[:, None] * b_np, axis=1)
+    )
+
+
+def test_geo_field_kernels(change_test_dir: Any, restore_isa: None) -> None:
+    time = pybFoam.Time(".", ".")
+    mesh = pybFoam.fvMesh(time)
+
+    C = mesh.C()
+    C_np = np.asarray(C["internalField"])
+    T = fvc.grad(C)()
+    T_np = np.random.default_rng(1).random((len(C_np), 9))
+    np.asarray(T["internalField"])[:] = T_np
+    S = pybFoam.symm(T)()
+    t = T_np.reshape(-1, 3, 3)
+    s = 0.5 * (t + t.transpose(0, 2, 1))
+
+    def internal(f: Callable[[], Any]) -> Callable[[], np.ndarray]:
+        return lambda: np.array(f()()["internalField"])
+
+    assert_identical(
+        results_per_isa(internal(lambda: pybFoam.mag(C))), np.linalg.norm(C_np, axis=1)
+    )
+    assert_identical(results_per_isa(internal(lambda: pybFoam.magSqr(C))), np.sum(C_np**2, axis=1))
+    assert_identical(
+        results_per_isa(internal(lambda: pybFoam.mag(T))), np.linalg.norm(T_np, axis=1)
+    )
+    assert_identical(results_per_isa(internal(lambda: pybFoam.magSqr(T))), np.sum(T_np**2, axis=1))
+    assert_identical(
+        results_per_isa(internal(lambda: pybFoam.symm(T))), s.reshape(-1, 9)[:, [0, 1, 2, 4, 5, 8]]
+    )
+
+    tr = np.trace(t, axis1=1, axis2=2)
+    dev2 = t - (2.0 / 3.0) * tr[:, None, None] * np.eye(3)
+    assert_identical(results_per_isa(internal(lambda: pybFoam.dev2(T))), dev2.reshape(-1, 9))
+    assert_identical(
+        results_per_isa(internal(lambda: pybFoam.dev2(S))),
+        (s - (2.0 / 3.0) * tr[:, None, None] * np.eye(3)).reshape(-1, 9)[:, [0, 1, 2, 4, 5, 8]],
+    )
+    assert_identical(
+        results_per_isa(internal(lambda: pybFoam.doubleInner(T, S))),
+        np.sum(t * s, axis=(1, 2)),
+    )
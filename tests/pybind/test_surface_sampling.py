@@ -10,12 +10,16 @@ from pybFoam.sampling import (
     SampledIsoSurfaceConfig,
     SampledPatchConfig,
     SampledPlaneConfig,
+    SurfaceStream,
     interpolationScalar,
     interpolationVector,
+    read_surface_stream,
     sampledSurface,
+    sampleFields,
     sampleOnFacesScalar,
     sampleOnFacesVector,
     sampleOnPointsScalar,
+    surfaceGeometry,
 )
 
 
@@ -415,3 +419,111 @@ def test_interpolation_scheme_comparison(change_test_dir: Any) -> None:
         # Allow outliers at boundaries
         assert np.min(result) >= 0.1, f"Scheme {scheme}: min too low"
         assert np.max(result) <= 1.7, f"Scheme {scheme}: max too high"
+
+
+@pytest.mark.parametrize("surface_type", ["plane", "patch"])
+def test_sample_fields(change_test_dir: Any, surface_type: str) -> None:
+    """sampleFields gives the same values as sampling the fields one by one."""
+    time, mesh = create_time_mesh()  # time must stay alive for mesh lifetime
+
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    U = volVectorField.read_field(mesh, "U")
+    np.asarray(p_rgh["internalField"])[:] = np.asarray(mesh.C()["internalField"])[:, 0]
+    np.asarray(U["internalField"])[:] = np.asarray(mesh.C()["internalField"])
+
+    if surface_type == "plane":
+        config: Any = SampledPlaneConfig(point=[0.5, 0.5, 0.005], normal=[0.0, 1.0, 0.0])
+    else:
+        config = SampledPatchConfig(patches=["leftWall"])
+    surface = sampledSurface.New(Word("testSurface"), mesh, config.to_foam_dict())
+    surface.update()
+
+    interp_p = interpolationScalar.New(Word("cellPoint"), p_rgh)
+    interp_U = interpolationVector.New(Word("cellPoint"), U)
+    result = sampleFields(surface, {"U": interp_U, "p_rgh": interp_p})
+
+    assert list(result) == ["U", "p_rgh"]
+    assert result["U"].shape == (len(surface.magSf()), 3)
+    assert np.array_equal(result["p_rgh"], np.asarray(sampleOnFacesScalar(surface, interp_p)))
+    assert np.array_equal(result["U"], np.asarray(sampleOnFacesVector(surface, interp_U)))
+
+    with pytest.raises(TypeError):
+        sampleFields(surface, {"p": p_rgh})  # type: ignore[dict-item]
+
+
+def test_surface_geometry_stream(change_test_dir: Any, tmp_path: Any) -> None:
+    """An invariant plane sends its geometry once, field values every step."""
+    time, mesh = create_time_mesh()  # time must stay alive for mesh lifetime
+
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    config = SampledPlaneConfig(point=[0.5, 0.5, 0.005], normal=[0.0, 1.0, 0.0])
+    surface = sampledSurface.New(Word("testSurface"), mesh, config.to_foam_dict())
+
+    geometry = surfaceGeometry(surface)
+    assert geometry.update()
+    assert not geometry.update()
+    assert geometry.version() == 1
+
+    offsets, labels = geometry.facesCSR()
+    n_faces = len(surface.magSf())
+    assert len(offsets) == n_faces + 1
+    assert offsets[-1] == len(labels)
+    assert labels.max() < len(geometry.points())
+    assert np.array_equal(surface.pointsArray(), geometry.points())
+    assert np.array_equal(surface.CfArray(), np.asarray(surface.Cf()))
+    assert np.allclose(np.linalg.norm(surface.SfArray(), axis=1), surface.magSfArray())
+    assert not surface.CfArray().flags.writeable
+
+    interp_p = interpolationScalar.New(Word("cell"), p_rgh)
+    path = tmp_path / "plane.bin"
+    with SurfaceStream(path, surface) as stream:
+        with pytest.raises(ValueError):
+            stream.write(0.0, {"p_rgh": np.zeros(n_faces)})  # no geometry yet
+        for step in range(3):
+            assert stream.update() == (step == 0)
+            np.asarray(p_rgh["internalField"])[:] = step
+            values = np.asarray(sampleOnFacesScalar(surface, interp_p))
+            stream.write(0.1 * step, {"p_rgh": values})
+        with pytest.raises(ValueError):
+            stream.write(0.3, {"p_rgh": values[:-1]})
+    assert stream.n_geometries == 1
+
+    data = read_surface_stream(path)
+    assert len(data.geometries) == 1
+    assert np.array_equal(data.geometries[0].offsets, offsets)
+    assert np.array_equal(data.geometries[0].point_labels, labels)
+    assert [frame.time for frame in data.frames] == [0.0, 0.1, 0.2]
+    assert all(frame.geometry == 0 for frame in data.frames)
+    assert np.array_equal(data.frames[2].fields["p_rgh"], np.full(n_faces, 2.0))
+
+
+def test_surface_stream_moving_surface(change_test_dir: Any, tmp_path: Any) -> None:
+    """Values sampled after update() are written with the geometry they belong to."""
+    time, mesh = create_time_mesh()  # time must stay alive for mesh lifetime
+
+    p_rgh = volScalarField.read_field(mesh, "p_rgh")
+    x = np.asarray(mesh.C()["internalField"])[:, 0]
+    config = SampledIsoSurfaceConfig(isoField="p_rgh", isoValue=0.5)
+    surface = sampledSurface.New(Word("movingIso"), mesh, config.to_foam_dict())
+    interp_p = interpolationScalar.New(Word("cell"), p_rgh)
+
+    path = tmp_path / "iso.bin"
+    shifts = [0.0, 0.2, 0.35]
+    with SurfaceStream(path, surface) as stream:
+        for shift in shifts:
+            # The iso-surface p_rgh = 0.5 moves to x = 0.5 + shift
+            time.increment()
+            np.asarray(p_rgh["internalField"])[:] = x - shift
+            p_rgh.correctBoundaryConditions()
+            assert stream.update()
+            values = np.asarray(sampleOnFacesScalar(surface, interp_p))
+            stream.write(time.value(), {"p_rgh": values, "x": np.asarray(surface.Cf())[:, 0]})
+
+    data = read_surface_stream(path)
+    assert len(data.geometries) == len(shifts)
+    for i, (frame, shift) in enumerate(zip(data.frames, shifts)):
+        assert frame.geometry == i
+        geometry = data.geometries[frame.geometry]
+        assert len(frame.fields["p_rgh"]) == len(geometry.offsets) - 1
+        assert np.allclose(geometry.points[:, 0].mean(), 0.5 + shift, atol=0.05)
+        assert np.allclose(frame.fields["x"].mean(), 0.5 + shift, atol=0.05)
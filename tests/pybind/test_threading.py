@@ -0,0 +1,86 @@
+"""
+Test the multithreaded field kernels (pybFoam.set_num_threads).
+
+The fields are large enough to be split into several chunks.
+"""
+
+import threading
+from typing import Generator
+
+import numpy as np
+import pytest
+
+import pybFoam
+from pybFoam import scalarField, vector, vectorField
+
+N = 100_000
+
+
+@pytest.fixture
+def four_threads() -> Generator[None, None, None]:
+    pybFoam.set_num_threads(4)
+    yield
+    pybFoam.set_num_threads(1)
+
+
+def test_set_num_threads(four_threads: None) -> None:
+    assert pybFoam.get_num_threads() == 4
+    pybFoam.set_num_threads(2)
+    assert pybFoam.get_num_threads() == 2
+    pybFoam.set_num_threads(0)
+    assert pybFoam.get_num_threads() >= 1
+
+
+def test_field_arithmetic(four_threads: None) -> None:
+    rng = np.random.default_rng(0)
+    a_np = rng.random(N)
+    b_np = rng.random(N) + 1.0
+    v_np = rng.random((N, 3))
+    a = scalarField(a_np)
+    b = scalarField(b_np)
+    v = vectorField(v_np)
+
+    assert np.allclose(np.asarray(a + b), a_np + b_np)
+    assert np.allclose(np.asarray(a - b), a_np - b_np)
+    assert np.allclose(np.asarray(a * 2.0), a_np * 2.0)
+    assert np.allclose(np.asarray(a / b), a_np / b_np)
+    assert np.allclose(np.asarray((a + b) * b), (a_np + b_np) * b_np)
+    assert np.allclose(np.asarray(v * a), v_np * a_np[:, None])
+    assert np.allclose(np.asarray(v + vector(1, 2, 3)), v_np + [1, 2, 3])
+
+    a += b
+    assert np.allclose(np.asarray(a), a_np + b_np)
+    a -= 1.0
+    assert np.allclose(np.asarray(a), a_np + b_np - 1.0)
+
+
+def test_sum(four_threads: None) -> None:
+    values = np.arange(N, dtype=np.float64)
+    assert pybFoam.sum(scalarField(values)) == pytest.approx(values.sum())
+
+    v = np.ones((N, 3))
+    s = pybFoam.sum(vectorField(v))
+    assert [s[0], s[1], s[2]] == pytest.approx([N, N, N])
+
+
+def test_size_mismatch(four_threads: None) -> None:
+    with pytest.raises(RuntimeError):
+        scalarField(np.ones(N)) + scalarField(np.ones(N - 1))
+
+
+def test_concurrent_python_threads(four_threads: None) -> None:
+    """Kernels release the GIL and may be called from several threads."""
+    fields = [scalarField(np.full(N, float(i))) for i in range(4)]
+    results: list[float] = [0.0] * 4
+
+    def work(i: int) -> None:
+        for _ in range(10):
+            results[i] = pybFoam.sum((fields[i] * 2.0)())
+
+    threads = [threading.Thread(target=work, args=(i,)) for i in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    assert results == pytest.approx([2.0 * i * N for i in range(4)])